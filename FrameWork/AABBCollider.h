@@ -31,6 +31,16 @@ public:
     // ===================================================================
     ~AABBCollider() override = default;
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    static constexpr const char* TypeName = "AABBCollider";
+    static constexpr auto ReflectFields()
+    {
+        return std::tuple_cat(ReflectColliderFields(), std::make_tuple(
+            MakeField("Size", &AABBCollider::m_Size)));
+    }
+
     // ===================================================================
     // Փ˔iI[o[Chj
     // ===================================================================
@@ -1,7 +1,5 @@
 #include	<vector>
 #include	<iostream>
-#include	<unordered_map>
-#include	<cassert>
 #include	"Texture.h"
 #include	"AssimpPerse.h"
 
@@ -9,174 +7,99 @@
 
 namespace AssimpPerse
 {
-	std::vector<std::vector<VERTEX>> g_vertices{};		// _f[^ibVPʁj
-	std::vector<std::vector<unsigned int>> g_indices{};	// CfbNXf[^ibVPʁj
-	std::vector<SUBSET> g_subsets{};					// TuZbg
-	std::vector<MATERIAL> g_materials{};				// }eA
-	std::vector<std::unique_ptr<Texture>> g_textures;	// fBt[YeNX`Q
-
-	// fBt[YTxtureReiԂ
-	std::vector<std::unique_ptr<Texture>> GetTextures()
+	namespace
 	{
-		return std::move(g_textures);
-	}
-
-	// }eAassimpgpĎ擾
-	void GetMaterialData(const aiScene* pScene, std::string texturedirectory)
-	{
-		// }eAeNX`i[GApӂ
-		g_textures.resize(pScene->mNumMaterials);
-
-		// }eA[v
-		for (unsigned int m = 0; m < pScene->mNumMaterials; m++)
+		// }eA̐F擾 (Ίl)
+		DirectX::SimpleMath::Color GetMaterialColor(const aiMaterial* material,
+			const char* key, unsigned int type, unsigned int index, const aiColor4D& defaultColor)
 		{
-			aiMaterial* material = pScene->mMaterials[m];
-
-			// }eA擾
-			std::string mtrlname = std::string(material->GetName().C_Str());
-			std::cout << mtrlname << std::endl;
-
-			// }eA
-			aiColor4D ambient;
-			aiColor4D diffuse;
-			aiColor4D specular;
-			aiColor4D emission;
-			float shiness;
-
-			// ArGg
-			if (AI_SUCCESS == aiGetMaterialColor(material, AI_MATKEY_COLOR_AMBIENT, &ambient)) {
-			}
-			else {
-				ambient = aiColor4D(0.0f, 0.0f, 0.0f, 0.0f);
+			aiColor4D color;
+			if (AI_SUCCESS != aiGetMaterialColor(material, key, type, index, &color)) {
+				color = defaultColor;
 			}
+			return DirectX::SimpleMath::Color(color.r, color.g, color.b, color.a);
+		}
 
-			// fBt[Y
-			if (AI_SUCCESS == aiGetMaterialColor(material, AI_MATKEY_COLOR_DIFFUSE, &diffuse)) {
-			}
-			else {
-				diffuse = aiColor4D(1.0f, 1.0f, 1.0f, 1.0f);
+		// fBt[YeNX`ǂݍ
+		void LoadDiffuseTexture(const aiScene* pScene, const aiMaterial* material,
+			const std::string& texturedirectory, MaterialData& data)
+		{
+			aiString path{};
+			if (material->GetTextureCount(aiTextureType_DIFFUSE) == 0 ||
+				AI_SUCCESS != material->Get(AI_MATKEY_TEXTURE(aiTextureType_DIFFUSE, 0), path))
+			{
+				return;
 			}
 
-			// XyL
-			if (AI_SUCCESS == aiGetMaterialColor(material, AI_MATKEY_COLOR_SPECULAR, &specular)) {
-			}
-			else {
-				specular = aiColor4D(0.0f, 0.0f, 0.0f, 0.0f);
+			// eNX`pXɁu:v܂܂Ăΐ΃pXȂ̂Ńt@Cɂ
+			std::string texpath = std::string(path.C_Str());
+			if (texpath.find(':') != std::string::npos) {
+				size_t pos = texpath.find_last_of("/\\");
+				if (pos != std::string::npos)
+				{
+					texpath = texpath.substr(pos + 1);
+				}
 			}
+			data.texturename = texpath;
 
-			// G~bV
-			if (AI_SUCCESS == aiGetMaterialColor(material, AI_MATKEY_COLOR_EMISSIVE, &emission)) {
-			}
-			else {
-				emission = aiColor4D(0.0f, 0.0f, 0.0f, 0.0f);
-			}
+			auto texture = std::make_unique<Texture>();
 
-			// VClX
-			if (AI_SUCCESS == aiGetMaterialFloat(material, AI_MATKEY_SHININESS, &shiness)) {
+			// eNX`ǂ𔻒f
+			if (const aiTexture* tex = pScene->GetEmbeddedTexture(path.C_Str())) {
+				// eNX`̏ꍇikf[^̂ݑΉBɂꍇ͕TCYj
+				if (texture->DecodeFromMemory(reinterpret_cast<const unsigned char*>(tex->pcData), tex->mWidth)) {
+					data.texture = std::move(texture);
+					data.textureembedded = true;
+				}
 			}
 			else {
-				shiness = 0.0f;
+				// OeNX`t@C̏ꍇ
+				if (texture->Decode(texturedirectory + "/" + texpath)) {
+					data.texture = std::move(texture);
+				}
 			}
+		}
 
-			// ̃}eAɕRÂĂfBt[YeNX`[v
-			std::vector<std::string> texpaths{};
+		// }eA擾
+		void LoadMaterials(const aiScene* pScene, const std::string& texturedirectory,
+			std::vector<MaterialData>& materials)
+		{
+			materials.clear();
+			materials.resize(pScene->mNumMaterials);
 
-			for (unsigned int t = 0; t < material->GetTextureCount(aiTextureType_DIFFUSE); t++)
+			for (unsigned int m = 0; m < pScene->mNumMaterials; m++)
 			{
-				aiString path{};
-
-				// tԖڂ̃eNX`pX擾
-				if (AI_SUCCESS == material->Get(AI_MATKEY_TEXTURE(aiTextureType_DIFFUSE, t), path))
-				{
-					// eNX`pX擾
-					std::string texpath = std::string(path.C_Str());
-					std::cout << texpath << std::endl;
-
-					// eNX`pXɁu:v܂܂Ăΐ΃pXȂ̂ŃpXH
-					if (texpath.find(':') != std::string::npos) {
-						// XbV܂̓obNXbVŌɌʒuT
-						size_t pos = texpath.find_last_of("/\\");
-						if (pos != std::string::npos)
-						{
-							// Ō̃XbV܂̓obNXbV̎當Ԃ
-							texpath = texpath.substr(pos + 1);
-						}
-					}
-					texpaths.push_back(texpath);
-
-					// eNX`ǂ𔻒f
-					if (auto tex = pScene->GetEmbeddedTexture(path.C_Str())) {
+				const aiMaterial* material = pScene->mMaterials[m];
+				MaterialData& data = materials[m];
 
-						std::unique_ptr<Texture> texture = std::make_unique<Texture>();
+				data.material.Ambient = GetMaterialColor(material, AI_MATKEY_COLOR_AMBIENT, aiColor4D(0.0f, 0.0f, 0.0f, 0.0f));
+				data.material.Diffuse = GetMaterialColor(material, AI_MATKEY_COLOR_DIFFUSE, aiColor4D(1.0f, 1.0f, 1.0f, 1.0f));
+				data.material.Specular = GetMaterialColor(material, AI_MATKEY_COLOR_SPECULAR, aiColor4D(0.0f, 0.0f, 0.0f, 0.0f));
+				data.material.Emission = GetMaterialColor(material, AI_MATKEY_COLOR_EMISSIVE, aiColor4D(0.0f, 0.0f, 0.0f, 0.0f));
 
-						// eNX`̏ꍇ
-						bool sts = texture->LoadFromFemory(
-							(unsigned char*)tex->pcData,			// 擪AhX
-							tex->mWidth);			// eNX`TCYiɂꍇTCYj	
-						if (sts) {
-							g_textures[m] = std::move(texture);
-						}
-						std::cout << "Embedded" << std::endl;
-
-					}
-					else {
-						// OeNX`t@C̏ꍇ
-						std::unique_ptr<Texture> texture;
-						texture = std::make_unique<Texture>();
-
-						std::string texname = texturedirectory + "/" + texpath;
-
-						bool sts = texture->Load(texname);
-						if (sts) {
-							g_textures[m] = std::move(texture);
-						}
-
-						std::cout << "other Embedded" << std::endl;
-					}
-				}
-				// fBt[YeNX`Ȃꍇ
-				else
-				{
-					// OeNX`t@C̏ꍇ
-					std::unique_ptr<Texture> texture;
-					texture = std::make_unique<Texture>();
-					g_textures[m] = std::move(texture);
+				float shiness = 0.0f;
+				if (AI_SUCCESS != aiGetMaterialFloat(material, AI_MATKEY_SHININESS, &shiness)) {
+					shiness = 0.0f;
 				}
-			}
+				data.material.Shiness = shiness;
 
-			// }eAۑ
-			AssimpPerse::MATERIAL mtrl{};
-			mtrl.mtrlname = mtrlname;
-			mtrl.Ambient = ambient;
-			mtrl.Diffuse = diffuse;
-			mtrl.Specular = specular;
-			mtrl.Emission = emission;
-			mtrl.Shiness = shiness;
-			if (texpaths.size() == 0)
-			{
-				mtrl.texturename = "";
-			}
-			else
-			{
-				mtrl.texturename = texpaths[0];
+				LoadDiffuseTexture(pScene, material, texturedirectory, data);
+				data.material.TextureEnable = data.texturename.empty() ? FALSE : TRUE;
 			}
-			g_materials.push_back(mtrl);
 		}
 	}
 
-	void GetModelData(std::string filename, std::string texturedirectory)
+	// ===================================================================
+	// fǂݍ
+	// ===================================================================
+	bool LoadModel(const std::string& filename, const std::string& texturedirectory,
+		std::vector<VERTEX_3D>& vertices,
+		std::vector<unsigned int>& indices,
+		std::vector<SUBSET>& subsets,
+		std::vector<MaterialData>& materials)
 	{
-		//f[^xNA
-		g_vertices.clear();		// _f[^
-		g_indices.clear();		// CfbNXf[^
-		g_subsets.clear();		// TuZbg
-		g_materials.clear();	// }eA
-		g_textures.clear(); 	// fBt[YeNX`Q
-
 		// V[\z
 		Assimp::Importer importer;
-
-		// V[\z
 		const aiScene* pScene = importer.ReadFile(
 			filename.c_str(),
 			aiProcess_ConvertToLeftHanded |	// Wnɕϊ
@@ -184,144 +107,98 @@ namespace AssimpPerse
 
 		if (pScene == nullptr)
 		{
-			std::cout << "load error" << filename.c_str() << importer.GetErrorString() << std::endl;
+			std::cerr << "[AssimpPerse] Load error " << filename << " " << importer.GetErrorString() << std::endl;
+			return false;
 		}
-		assert(pScene != nullptr);
 
 		// }eA擾
-		GetMaterialData(pScene, texturedirectory);
+		LoadMaterials(pScene, texturedirectory, materials);
+
+		// TuZbgƑŜ̑傫ɋ߂ibV̓}eAɕĂj
+		subsets.assign(pScene->mNumMeshes, SUBSET{});
+		unsigned int vertexTotal = 0;
+		unsigned int indexTotal = 0;
+		for (unsigned int m = 0; m < pScene->mNumMeshes; m++)
+		{
+			const aiMesh* mesh = pScene->mMeshes[m];
+
+			SUBSET& subset = subsets[m];
+			subset.VertexBase = vertexTotal;
+			subset.VertexNum = mesh->mNumVertices;
+			subset.IndexBase = indexTotal;
+			subset.IndexNum = mesh->mNumFaces * 3;	// Op`ς
+			subset.MaterialIdx = mesh->mMaterialIndex;
+			subset.MtrlName = pScene->mMaterials[mesh->mMaterialIndex]->GetName().C_Str();
+
+			vertexTotal += subset.VertexNum;
+			indexTotal += subset.IndexNum;
+		}
 
-		// bV[vi}eAɃbV𕪊悤Ɏw肵Ăj
-		g_vertices.resize(pScene->mNumMeshes);
+		// _ECfbNXxɊmۂĒڏ
+		vertices.resize(vertexTotal);
+		indices.resize(indexTotal);
 
 		for (unsigned int m = 0; m < pScene->mNumMeshes; m++)
 		{
-			aiMesh* mesh = pScene->mMeshes[m];
+			const aiMesh* mesh = pScene->mMeshes[m];
+			const SUBSET& subset = subsets[m];
 
-			// bV擾
-			std::string meshname = std::string(mesh->mName.C_Str());
+			const bool hasNormals = mesh->HasNormals();
+			const bool hasColors = mesh->HasVertexColors(0);
+			const bool hasTexcoords = mesh->HasTextureCoords(0);
 
-			//@_[v
+			VERTEX_3D* dst = vertices.data() + subset.VertexBase;
 			for (unsigned int vidx = 0; vidx < mesh->mNumVertices; vidx++)
 			{
-				// _f[^
-				VERTEX	v{};
-				v.meshname = meshname;		// bVZbg
-
-				// W		
-				v.pos = mesh->mVertices[vidx];
-
-				// ̒_gpĂ}eÃCfbNXԍibV́j
-				// gpă}eAZbg
-				v.materialindex = mesh->mMaterialIndex;
-
-				v.mtrlname = g_materials[mesh->mMaterialIndex].mtrlname;
+				const aiVector3D& pos = mesh->mVertices[vidx];
+				dst[vidx].position = DirectX::SimpleMath::Vector3(pos.x, pos.y, pos.z);
 
 				// @H
-				if (mesh->HasNormals()) {
-					v.normal = mesh->mNormals[vidx];
+				if (hasNormals) {
+					const aiVector3D& normal = mesh->mNormals[vidx];
+					dst[vidx].normal = DirectX::SimpleMath::Vector3(normal.x, normal.y, normal.z);
 				}
-				else
-				{
-					v.normal = aiVector3D(0.0f, 0.0f, 0.0f);
+				else {
+					dst[vidx].normal = DirectX::SimpleMath::Vector3(0.0f, 0.0f, 0.0f);
 				}
 
 				// _J[HiOԖځj
-				if (mesh->HasVertexColors(0)) {
-					v.color = mesh->mColors[0][vidx];
+				if (hasColors) {
+					const aiColor4D& color = mesh->mColors[0][vidx];
+					dst[vidx].color = DirectX::SimpleMath::Color(color.r, color.g, color.b, color.a);
 				}
-				else
-				{
-					v.color = aiColor4D(1.0f, 1.0f, 1.0f, 1.0f);
+				else {
+					dst[vidx].color = DirectX::SimpleMath::Color(1.0f, 1.0f, 1.0f, 1.0f);
 				}
 
 				// eNX`HiOԖځj
-				if (mesh->HasTextureCoords(0)) {
-					v.texcoord = mesh->mTextureCoords[0][vidx];
+				if (hasTexcoords) {
+					const aiVector3D& texcoord = mesh->mTextureCoords[0][vidx];
+					dst[vidx].uv = DirectX::SimpleMath::Vector2(texcoord.x, texcoord.y);
 				}
-				else
-				{
-					v.texcoord = aiVector3D(0.0f, 0.0f, 0.0f);
+				else {
+					dst[vidx].uv = DirectX::SimpleMath::Vector2(0.0f, 0.0f);
 				}
-
-				// _f[^ǉ
-				g_vertices[m].push_back(v);
 			}
-		}
-
-		// bV[v
-		// CfbNXf[^쐬
-		g_indices.resize(pScene->mNumMeshes);
-		for (unsigned int m = 0; m < pScene->mNumMeshes; m++)
-		{
-			aiMesh* mesh = pScene->mMeshes[m];
-
-			// bV擾
-			std::string meshname = std::string(mesh->mName.C_Str());
 
-			// CfbNX[v
+			// CfbNXibV̑Βlj
+			unsigned int* index = indices.data() + subset.IndexBase;
 			for (unsigned int fidx = 0; fidx < mesh->mNumFaces; fidx++)
 			{
-				aiFace face = mesh->mFaces[fidx];
-
-				assert(face.mNumIndices == 3);	// Op`̂ݑΉ
-
-				// CfbNXf[^ǉ
-				for (unsigned int i = 0; i < face.mNumIndices; i++)
+				const aiFace& face = mesh->mFaces[fidx];
+				if (face.mNumIndices != 3)
 				{
-					g_indices[m].push_back(face.mIndices[i]);
+					// _E͎Op`ꂸɎĉœǂݍ߂Ȃ
+					std::cerr << "[AssimpPerse] Non-triangle face in " << filename << std::endl;
+					return false;
 				}
+				index[0] = face.mIndices[0];
+				index[1] = face.mIndices[1];
+				index[2] = face.mIndices[2];
+				index += 3;
 			}
 		}
 
-		// TuZbg𐶐
-		g_subsets.resize(pScene->mNumMeshes);
-		for (unsigned int m = 0; m < g_subsets.size(); m++)
-		{
-			g_subsets[m].IndexNum = (unsigned int)g_indices[m].size();
-			g_subsets[m].VertexNum = (unsigned int)g_vertices[m].size();
-			g_subsets[m].VertexBase = 0;
-			g_subsets[m].IndexBase = 0;
-			g_subsets[m].meshname = g_vertices[m][0].meshname;
-			g_subsets[m].mtrlname = g_vertices[m][0].mtrlname;
-			g_subsets[m].materialindex = g_vertices[m][0].materialindex;
-		}
-
-		// TuZbg𑊑ΓIȂ̂ɂ	
-		for (int m = 0; m < g_subsets.size(); m++)
-		{
-			// _obt@̃x[XvZ
-			g_subsets[m].VertexBase = 0;
-			for (int i = m - 1; i >= 0; i--) {
-				g_subsets[m].VertexBase += g_subsets[i].VertexNum;
-			}
-
-			// CfbNXobt@̃x[XvZ
-			g_subsets[m].IndexBase = 0;
-			for (int i = m - 1; i >= 0; i--) {
-				g_subsets[m].IndexBase += g_subsets[i].IndexNum;
-			}
-		}
-	}
-
-	// TuZbg
-	std::vector<SUBSET> GetSubsets()
-	{
-		return g_subsets;
-	}
-
-	std::vector<std::vector<VERTEX>> GetVertices()
-	{
-		return g_vertices; // _f[^ibVPʁj
-	}
-
-	std::vector<std::vector<unsigned int>> GetIndices()
-	{
-		return g_indices; // CfbNXf[^ibVPʁj
-	}
-
-	std::vector<MATERIAL> GetMaterials()
-	{
-		return g_materials; // }eA
+		return true;
 	}
-}
+}
\ No newline at end of file
@@ -1,45 +1,36 @@
 #pragma once
+#include	<memory>
+#include	<string>
+#include	<vector>
 #include	<assimp/Importer.hpp>
 #include	<assimp/scene.h>
 #include	<assimp/postprocess.h>
 #include	<assimp/cimport.h>
+#include	"renderer.h"
 
+class Texture;
+
+// ===================================================================
+// assimp ɂ郂fǂݍ
+// ǂݍ݌ʂ͌Ăяo̔zɒڏ (O[oȏԂȂ̂ŁA
+// ʁX̃f𕡐̃Xbh瓯ɓǂݍ߂)
+// ===================================================================
 namespace AssimpPerse
 {
-	struct VERTEX {
-		std::string meshname;		// bV
-		aiVector3D	pos;			// ʒu
-		aiVector3D	normal;			// @
-		aiColor4D	color;			// _J[	
-		aiVector3D	texcoord;		// eNX`W	
-		int			materialindex;	// }eACfbNX
-		std::string mtrlname;		// }eA
-	};
-
-	struct SUBSET {
-		std::string meshname;		// bV
-		int materialindex;			// }eACfbNX
-		unsigned int VertexBase;	// _obt@̃x[X
-		unsigned int VertexNum;		// _
-		unsigned int IndexBase;		// CfbNXobt@̃x[X
-		unsigned int IndexNum;		// CfbNX
-		std::string	 mtrlname;		// }eA
-	};
-
-	struct MATERIAL {
-		std::string mtrlname;		// }eA
-		aiColor4D	Ambient;		// ArGg
-		aiColor4D	Diffuse;		// fBt[Y
-		aiColor4D	Specular;		// XyL
-		aiColor4D	Emission;		// G~bV
-		float		Shiness;		// VClX
-		std::string texturename;	// eNX`
+	// }eA
+	struct MaterialData {
+		MATERIAL	material{};					// 萔obt@ɓnl
+		std::string	texturename;				// fBt[YeNX` (΋)
+		std::unique_ptr<Texture> texture;		// fR[hς݂̃eNX` (GPU] StaticMesh::Upload)
+		bool		textureembedded = false;	// eNX`ft@CɓĂ邩
 	};
 
-	void GetModelData(std::string filename, std::string texturedirectory);
-	std::vector<SUBSET> GetSubsets();
-	std::vector<std::vector<VERTEX>> GetVertices();
-	std::vector<std::vector<unsigned int>> GetIndices();
-	std::vector<MATERIAL> GetMaterials();
-	std::vector<std::unique_ptr<Texture>> GetTextures();
-}
+	// fǂݍ (ǂ߂Ȃ false)
+	// vertices / indices  aiMesh ̒_EʐxmۂAVERTEX_3D ɒڏ
+	// CfbNX̓bVƂ̑Βl (TuZbg VertexBase 𑫂Ďg)
+	bool LoadModel(const std::string& filename, const std::string& texturedirectory,
+		std::vector<VERTEX_3D>& vertices,
+		std::vector<unsigned int>& indices,
+		std::vector<SUBSET>& subsets,
+		std::vector<MaterialData>& materials);
+}
\ No newline at end of file
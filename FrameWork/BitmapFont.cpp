@@ -39,8 +39,8 @@ bool BitmapFont::Init(
         return false;
     }
 
-    // eNX`ǂݍ
-    m_Texture = M_RESOURCE.LoadTexture(texturePath);
+    // eNX`ǂݍ (Ot̃AgXȂ̂ňkE~bv)
+    m_Texture = M_RESOURCE.LoadTexture(texturePath, TF_RGBA8);
 
     if (!m_Texture)
     {
@@ -0,0 +1,466 @@
+// ===================================================================
+// BlockCompressor.cpp
+// BC1 / BC3 / BC7 ̈k
+// ===================================================================
+#include "BlockCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace BlockCompressor
+{
+	namespace
+	{
+		// BC7 4rbgԍ̕Ԃ̏d (/64)
+		constexpr int BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		using Block = float[16][4];
+
+		void LoadBlock(const uint8_t* block, Block& px)
+		{
+			for (int i = 0; i < 16; i++)
+			{
+				for (int c = 0; c < 4; c++) px[i][c] = block[i * 4 + c];
+			}
+		}
+
+		// ===================================================================
+		// 听 (擪 channels `lŁAf̕Uő̕)
+		// E{bNX̑Ίpn߂āAUsJԂ|
+		// ===================================================================
+		void PrincipalAxis(const Block& px, int channels, float* mean, float* axis)
+		{
+			float minimum[4] = { 255, 255, 255, 255 };
+			float maximum[4] = { 0, 0, 0, 0 };
+			for (int c = 0; c < 4; c++) mean[c] = axis[c] = 0.0f;
+			for (int i = 0; i < 16; i++)
+			{
+				for (int c = 0; c < channels; c++)
+				{
+					mean[c] += px[i][c] / 16.0f;
+					minimum[c] = std::min(minimum[c], px[i][c]);
+					maximum[c] = std::max(maximum[c], px[i][c]);
+				}
+			}
+
+			float cov[4][4] = {};
+			for (int i = 0; i < 16; i++)
+			{
+				for (int a = 0; a < channels; a++)
+				{
+					for (int b = 0; b < channels; b++)
+					{
+						cov[a][b] += (px[i][a] - mean[a]) * (px[i][b] - mean[b]);
+					}
+				}
+			}
+
+			for (int c = 0; c < channels; c++) axis[c] = maximum[c] - minimum[c];
+			for (int iteration = 0; iteration < 8; iteration++)
+			{
+				float next[4] = {};
+				float largest = 0.0f;
+				for (int a = 0; a < channels; a++)
+				{
+					for (int b = 0; b < channels; b++) next[a] += cov[a][b] * axis[b];
+					largest = std::max(largest, std::abs(next[a]));
+				}
+				if (largest <= 0.0f) break;
+				for (int c = 0; c < channels; c++) axis[c] = next[c] / largest;
+			}
+
+			float length = 0.0f;
+			for (int c = 0; c < channels; c++) length += axis[c] * axis[c];
+			length = std::sqrt(length);
+			for (int c = 0; c < channels; c++) axis[c] = length > 0.0f ? axis[c] / length : 0.0f;
+		}
+
+		// 听̗[ (first ̕)
+		void AxisEndpoints(const Block& px, int channels, float* first, float* second)
+		{
+			float mean[4], axis[4];
+			PrincipalAxis(px, channels, mean, axis);
+
+			float tmin = 0.0f, tmax = 0.0f;
+			for (int i = 0; i < 16; i++)
+			{
+				float t = 0.0f;
+				for (int c = 0; c < channels; c++) t += (px[i][c] - mean[c]) * axis[c];
+				tmin = std::min(tmin, t);
+				tmax = std::max(tmax, t);
+			}
+			for (int c = 0; c < 4; c++)
+			{
+				first[c] = std::clamp(mean[c] + axis[c] * tmin, 0.0f, 255.0f);
+				second[c] = std::clamp(mean[c] + axis[c] * tmax, 0.0f, 255.0f);
+			}
+		}
+
+		// ===================================================================
+		// ԍŒ肵āA[_ŏŋߒ
+		// weights[ԍ]  e0 ̏d (e1 ̏d݂ 1 - weights)
+		// ===================================================================
+		bool SolveEndpoints(const Block& px, const uint8_t* indices, const float* weights, int channels,
+			float* e0, float* e1)
+		{
+			float a = 0.0f, b = 0.0f, c = 0.0f;
+			float x0[4] = {}, x1[4] = {};
+			for (int i = 0; i < 16; i++)
+			{
+				float w = weights[indices[i]];
+				a += w * w;
+				b += w * (1.0f - w);
+				c += (1.0f - w) * (1.0f - w);
+				for (int k = 0; k < channels; k++)
+				{
+					x0[k] += w * px[i][k];
+					x1[k] += (1.0f - w) * px[i][k];
+				}
+			}
+
+			float det = a * c - b * b;
+			if (std::abs(det) < 1e-6f) return false;
+			for (int k = 0; k < channels; k++)
+			{
+				e0[k] = std::clamp((c * x0[k] - b * x1[k]) / det, 0.0f, 255.0f);
+				e1[k] = std::clamp((a * x1[k] - b * x0[k]) / det, 0.0f, 255.0f);
+			}
+			return true;
+		}
+
+		// ===================================================================
+		// FubN (BC1BBC3 ̌㔼)
+		// ===================================================================
+		uint16_t To565(const float* c)
+		{
+			int r = std::clamp(static_cast<int>(std::lround(c[0] * 31.0f / 255.0f)), 0, 31);
+			int g = std::clamp(static_cast<int>(std::lround(c[1] * 63.0f / 255.0f)), 0, 63);
+			int b = std::clamp(static_cast<int>(std::lround(c[2] * 31.0f / 255.0f)), 0, 31);
+			return static_cast<uint16_t>(r << 11 | g << 5 | b);
+		}
+
+		void From565(uint16_t v, float* c)
+		{
+			int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+			c[0] = static_cast<float>(r << 3 | r >> 2);
+			c[1] = static_cast<float>(g << 2 | g >> 4);
+			c[2] = static_cast<float>(b << 3 | b >> 2);
+		}
+
+		// 4F (c0, c1, 2:1, 1:2) ̃pbgŔԍIсA덷Ԃ
+		float FitColorIndices(const Block& px, uint16_t c0, uint16_t c1, uint8_t* indices)
+		{
+			float palette[4][3];
+			From565(c0, palette[0]);
+			From565(c1, palette[1]);
+			for (int k = 0; k < 3; k++)
+			{
+				palette[2][k] = (2.0f * palette[0][k] + palette[1][k]) / 3.0f;
+				palette[3][k] = (palette[0][k] + 2.0f * palette[1][k]) / 3.0f;
+			}
+
+			float error = 0.0f;
+			for (int i = 0; i < 16; i++)
+			{
+				float best = 1e30f;
+				for (int p = 0; p < 4; p++)
+				{
+					float d = 0.0f;
+					for (int k = 0; k < 3; k++) d += (px[i][k] - palette[p][k]) * (px[i][k] - palette[p][k]);
+					if (d < best)
+					{
+						best = d;
+						indices[i] = static_cast<uint8_t>(p);
+					}
+				}
+				error += best;
+			}
+			return error;
+		}
+
+		void EncodeColorBlock(const Block& px, uint8_t* out)
+		{
+			float e0[4], e1[4];
+			AxisEndpoints(px, 3, e1, e0);
+			uint16_t c0 = To565(e0);
+			uint16_t c1 = To565(e1);
+			uint8_t indices[16];
+			float error = FitColorIndices(px, c0, c1, indices);
+
+			// ŏŋlߒ (ǂȂꍇ̂ݎg)
+			static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+			float r0[4], r1[4];
+			if (SolveEndpoints(px, indices, weights, 3, r0, r1))
+			{
+				uint16_t n0 = To565(r0);
+				uint16_t n1 = To565(r1);
+				uint8_t refined[16];
+				float refinedError = FitColorIndices(px, n0, n1, refined);
+				if (refinedError < error)
+				{
+					c0 = n0;
+					c1 = n1;
+					std::memcpy(indices, refined, sizeof(indices));
+				}
+			}
+
+			// 4FƂēǂ܂ɂ c0 > c1 (ւԍ 01, 23 ւ)
+			if (c0 < c1)
+			{
+				std::swap(c0, c1);
+				for (uint8_t& index : indices) index ^= 1;
+			}
+			else if (c0 == c1)
+			{
+				std::memset(indices, 0, sizeof(indices));
+			}
+
+			uint32_t bits = 0;
+			for (int i = 0; i < 16; i++) bits |= uint32_t(indices[i]) << (2 * i);
+			out[0] = static_cast<uint8_t>(c0);
+			out[1] = static_cast<uint8_t>(c0 >> 8);
+			out[2] = static_cast<uint8_t>(c1);
+			out[3] = static_cast<uint8_t>(c1 >> 8);
+			for (int b = 0; b < 4; b++) out[4 + b] = static_cast<uint8_t>(bits >> (8 * b));
+		}
+
+		// ===================================================================
+		// At@ubN (BC3 ̑OBőEŏ̊Ԃ78iK)
+		// ===================================================================
+		void EncodeAlphaBlock(const Block& px, uint8_t* out)
+		{
+			int a0 = 0, a1 = 255;
+			for (int i = 0; i < 16; i++)
+			{
+				a0 = std::max(a0, static_cast<int>(px[i][3]));
+				a1 = std::min(a1, static_cast<int>(px[i][3]));
+			}
+			out[0] = static_cast<uint8_t>(a0);
+			out[1] = static_cast<uint8_t>(a1);
+
+			uint64_t bits = 0;
+			if (a0 > a1)
+			{
+				float palette[8] = { float(a0), float(a1) };
+				for (int k = 2; k < 8; k++) palette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7.0f;
+				for (int i = 0; i < 16; i++)
+				{
+					int best = 0;
+					for (int k = 1; k < 8; k++)
+					{
+						if (std::abs(px[i][3] - palette[k]) < std::abs(px[i][3] - palette[best])) best = k;
+					}
+					bits |= uint64_t(best) << (3 * i);
+				}
+			}
+			for (int b = 0; b < 6; b++) out[2 + b] = static_cast<uint8_t>(bits >> (8 * b));
+		}
+
+		// ===================================================================
+		// BC7 [h6
+		// ===================================================================
+
+		// [_ 7rbg + Prbgɂ (Prbg͒[_̑S`lŋʁBsȂ1ɂăAt@255ɕۂ)
+		void QuantizeBC7(const float* e, bool opaque, int* q, int& p)
+		{
+			float bestError = 1e30f;
+			for (int pbit = opaque ? 1 : 0; pbit < 2; pbit++)
+			{
+				int candidate[4];
+				float error = 0.0f;
+				for (int c = 0; c < 4; c++)
+				{
+					candidate[c] = std::clamp(static_cast<int>(std::lround((e[c] - pbit) / 2.0f)), 0, 127);
+					float d = float(candidate[c] * 2 + pbit) - e[c];
+					error += d * d;
+				}
+				if (error < bestError)
+				{
+					bestError = error;
+					p = pbit;
+					std::memcpy(q, candidate, sizeof(candidate));
+				}
+			}
+		}
+
+		// 16iK̃pbgŔԍIсA덷Ԃ
+		float FitBC7Indices(const Block& px, const int* q0, int p0, const int* q1, int p1, uint8_t* indices)
+		{
+			int palette[16][4];
+			for (int k = 0; k < 16; k++)
+			{
+				for (int c = 0; c < 4; c++)
+				{
+					int v0 = q0[c] * 2 + p0;
+					int v1 = q1[c] * 2 + p1;
+					palette[k][c] = ((64 - BC7Weights[k]) * v0 + BC7Weights[k] * v1 + 32) >> 6;
+				}
+			}
+
+			float error = 0.0f;
+			for (int i = 0; i < 16; i++)
+			{
+				float best = 1e30f;
+				for (int k = 0; k < 16; k++)
+				{
+					float d = 0.0f;
+					for (int c = 0; c < 4; c++) d += (px[i][c] - palette[k][c]) * (px[i][c] - palette[k][c]);
+					if (d < best)
+					{
+						best = d;
+						indices[i] = static_cast<uint8_t>(k);
+					}
+				}
+				error += best;
+			}
+			return error;
+		}
+
+		// 128rbg։ʂl߂
+		struct BitWriter
+		{
+			uint8_t* out;
+			int position = 0;
+
+			void Write(uint32_t value, int bits)
+			{
+				for (int i = 0; i < bits; i++, position++)
+				{
+					if ((value >> i) & 1) out[position >> 3] |= static_cast<uint8_t>(1 << (position & 7));
+				}
+			}
+		};
+	}
+
+	// ===================================================================
+	// 1ubN̈k
+	// ===================================================================
+	void EncodeBC1(const uint8_t* block, uint8_t* out)
+	{
+		Block px;
+		LoadBlock(block, px);
+		EncodeColorBlock(px, out);
+	}
+
+	void EncodeBC3(const uint8_t* block, uint8_t* out)
+	{
+		Block px;
+		LoadBlock(block, px);
+		EncodeAlphaBlock(px, out);
+		EncodeColorBlock(px, out + 8);
+	}
+
+	void EncodeBC7(const uint8_t* block, uint8_t* out)
+	{
+		Block px;
+		LoadBlock(block, px);
+		bool opaque = true;
+		for (int i = 0; i < 16; i++) opaque = opaque && block[i * 4 + 3] == 255;
+
+		// 听̗[
+		float e0[4], e1[4];
+		AxisEndpoints(px, 4, e0, e1);
+		int q0[4], q1[4], p0 = 0, p1 = 0;
+		QuantizeBC7(e0, opaque, q0, p0);
+		QuantizeBC7(e1, opaque, q1, p1);
+		uint8_t indices[16];
+		float error = FitBC7Indices(px, q0, p0, q1, p1, indices);
+
+		// ŏŋlߒ (ǂȂꍇ̂ݎg)
+		float weights[16];
+		for (int k = 0; k < 16; k++) weights[k] = 1.0f - BC7Weights[k] / 64.0f;
+		float r0[4], r1[4];
+		if (SolveEndpoints(px, indices, weights, 4, r0, r1))
+		{
+			int n0[4], n1[4], np0 = 0, np1 = 0;
+			QuantizeBC7(r0, opaque, n0, np0);
+			QuantizeBC7(r1, opaque, n1, np1);
+			uint8_t refined[16];
+			float refinedError = FitBC7Indices(px, n0, np0, n1, np1, refined);
+			if (refinedError < error)
+			{
+				std::memcpy(q0, n0, sizeof(q0));
+				std::memcpy(q1, n1, sizeof(q1));
+				p0 = np0;
+				p1 = np1;
+				std::memcpy(indices, refined, sizeof(indices));
+			}
+		}
+
+		// 擪̉f̔ԍ͍ŏʃrbgȂ̂ 8 ɂ ([_ւĔԍ𔽓])
+		if (indices[0] >= 8)
+		{
+			std::swap(q0, q1);
+			std::swap(p0, p1);
+			for (uint8_t& index : indices) index = static_cast<uint8_t>(15 - index);
+		}
+
+		std::memset(out, 0, 16);
+		BitWriter writer{ out };
+		writer.Write(1 << 6, 7);					// [h6
+		for (int c = 0; c < 4; c++)
+		{
+			writer.Write(q0[c], 7);
+			writer.Write(q1[c], 7);
+		}
+		writer.Write(p0, 1);
+		writer.Write(p1, 1);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < 16; i++) writer.Write(indices[i], 4);
+	}
+
+	// ===================================================================
+	// 摜Ŝ̈k
+	// ===================================================================
+	std::vector<uint8_t> Compress(const uint8_t* rgba, uint32_t width, uint32_t height, ETextureFormat format)
+	{
+		const uint32_t blockBytes = format == TF_BC1 ? 8 : 16;
+		const uint32_t blocksX = std::max(1u, (width + 3) / 4);
+		const uint32_t blocksY = std::max(1u, (height + 3) / 4);
+		std::vector<uint8_t> compressed(size_t(blocksX) * blocksY * blockBytes);
+
+		uint8_t block[16 * 4];
+		for (uint32_t by = 0; by < blocksY; by++)
+		{
+			for (uint32_t bx = 0; bx < blocksX; bx++)
+			{
+				// 4x4 ؂o (͂ݏo͒[̉f)
+				for (uint32_t y = 0; y < 4; y++)
+				{
+					uint32_t sy = std::min(by * 4 + y, height - 1);
+					for (uint32_t x = 0; x < 4; x++)
+					{
+						uint32_t sx = std::min(bx * 4 + x, width - 1);
+						std::memcpy(block + (y * 4 + x) * 4, rgba + (size_t(sy) * width + sx) * 4, 4);
+					}
+				}
+
+				uint8_t* out = compressed.data() + (size_t(by) * blocksX + bx) * blockBytes;
+				switch (format)
+				{
+				case TF_BC1: EncodeBC1(block, out); break;
+				case TF_BC3: EncodeBC3(block, out); break;
+				case TF_BC7: EncodeBC7(block, out); break;
+				default: break;
+				}
+			}
+		}
+		return compressed;
+	}
+
+	// ===================================================================
+	// `
+	// ===================================================================
+	DXGI_FORMAT GetDxgiFormat(ETextureFormat format)
+	{
+		switch (format)
+		{
+		case TF_RGBA8: return DXGI_FORMAT_R8G8B8A8_UNORM;
+		case TF_BC1: return DXGI_FORMAT_BC1_UNORM;
+		case TF_BC3: return DXGI_FORMAT_BC3_UNORM;
+		case TF_BC7: return DXGI_FORMAT_BC7_UNORM;
+		default: return DXGI_FORMAT_UNKNOWN;
+		}
+	}
+}
\ No newline at end of file
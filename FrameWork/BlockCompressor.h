@@ -0,0 +1,28 @@
+// ===================================================================
+// BlockCompressor.h
+// RGBA8 摜̃ubNk (4x4 f1ubNɂBϊς݃eNX`p)
+//   BC1 : 8oCg/ubNBRGB565 ̒[_2 + 2rbg̕Ԕԍ (At@͎̂Ă)
+//   BC3 : 16oCg/ubNBAt@ (8rbg[_ + 3rbgԍ) + BC1 ̐F
+//   BC7 : 16oCg/ubNB[h6 (RGBA 7rbg + Prbg̒[_ + 4rbgԍ) ̂ݎg
+// [_͉f̎听 (Uő̕) ̗[狁߁Aŏ1lߒ
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "TextureFile.h"
+
+namespace BlockCompressor
+{
+	// 1ubNk (block  16 f RGBA8BsD)
+	void EncodeBC1(const uint8_t* block, uint8_t* out);
+	void EncodeBC3(const uint8_t* block, uint8_t* out);
+	void EncodeBC7(const uint8_t* block, uint8_t* out);
+
+	// 摜Ŝk (format  TF_BC1 / TF_BC3 / TF_BC7)
+	// E4̔{łȂĂ悢 ([̃ubN͍Ō̉fJԂ)
+	std::vector<uint8_t> Compress(const uint8_t* rgba, uint32_t width, uint32_t height, ETextureFormat format);
+
+	// `ɑΉ DXGI_FORMAT (TF_AUTO ͕s)
+	DXGI_FORMAT GetDxgiFormat(ETextureFormat format);
+}
\ No newline at end of file
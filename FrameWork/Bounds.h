@@ -0,0 +1,156 @@
+// ===================================================================
+// Bounds.h
+// sE{bNX (AABB) Ǝ
+// ԃCfbNX (LooseOctree)EJOEߖTŋʂɎg
+// ===================================================================
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+#include "SystemCommon.h"
+
+// ===================================================================
+// Bounds (ŏ_Eő_ŕ\AABB)
+// ===================================================================
+struct Bounds
+{
+	Vector3 min;
+	Vector3 max;
+
+	Bounds() : min(0.0f, 0.0f, 0.0f), max(0.0f, 0.0f, 0.0f) {}
+	Bounds(const Vector3& _min, const Vector3& _max) : min(_min), max(_max) {}
+
+	// SƔa (e̔̑傫) 쐬
+	static Bounds FromCenterExtents(const Vector3& center, const Vector3& extents)
+	{
+		return Bounds(
+			Vector3(center.x - extents.x, center.y - extents.y, center.z - extents.z),
+			Vector3(center.x + extents.x, center.y + extents.y, center.z + extents.z));
+	}
+
+	// S
+	Vector3 GetCenter() const
+	{
+		return Vector3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+	}
+
+	// e̔̑傫
+	Vector3 GetExtents() const
+	{
+		return Vector3((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);
+	}
+
+	// _܂ނ悤ɍL
+	void Encapsulate(const Vector3& p)
+	{
+		min = Vector3((std::min)(min.x, p.x), (std::min)(min.y, p.y), (std::min)(min.z, p.z));
+		max = Vector3((std::max)(max.x, p.x), (std::max)(max.y, p.y), (std::max)(max.z, p.z));
+	}
+
+	// ʂ̃{bNX܂ނ悤ɍL
+	void Encapsulate(const Bounds& other)
+	{
+		Encapsulate(other.min);
+		Encapsulate(other.max);
+	}
+
+	// ===================================================================
+	// 
+	// ===================================================================
+
+	bool Contains(const Vector3& p) const
+	{
+		return p.x >= min.x && p.x <= max.x &&
+			p.y >= min.y && p.y <= max.y &&
+			p.z >= min.z && p.z <= max.z;
+	}
+
+	bool Intersects(const Bounds& other) const
+	{
+		return min.x <= other.max.x && max.x >= other.min.x &&
+			min.y <= other.max.y && max.y >= other.min.y &&
+			min.z <= other.max.z && max.z >= other.min.z;
+	}
+
+	// Ƃ̌ ({bNX̍ŋߓ_܂ł̋Ŕ)
+	bool IntersectsSphere(const Vector3& center, float radius) const
+	{
+		float dx = (std::max)((std::max)(min.x - center.x, 0.0f), center.x - max.x);
+		float dy = (std::max)((std::max)(min.y - center.y, 0.0f), center.y - max.y);
+		float dz = (std::max)((std::max)(min.z - center.z, 0.0f), center.z - max.z);
+		return dx * dx + dy * dy + dz * dz <= radius * radius;
+	}
+
+	// ===================================================================
+	// ϊ
+	// ===================================================================
+
+	// sŕϊ{bNX͂AABB (8_ϊASƔa𒼐ڋ߂)
+	Bounds Transformed(const Matrix& m) const
+	{
+		Vector3 c = GetCenter();
+		Vector3 e = GetExtents();
+
+		Vector3 center(
+			c.x * m._11 + c.y * m._21 + c.z * m._31 + m._41,
+			c.x * m._12 + c.y * m._22 + c.z * m._32 + m._42,
+			c.x * m._13 + c.y * m._23 + c.z * m._33 + m._43);
+		Vector3 extents(
+			e.x * std::fabs(m._11) + e.y * std::fabs(m._21) + e.z * std::fabs(m._31),
+			e.x * std::fabs(m._12) + e.y * std::fabs(m._22) + e.z * std::fabs(m._32),
+			e.x * std::fabs(m._13) + e.y * std::fabs(m._23) + e.z * std::fabs(m._33));
+
+		return FromCenterExtents(center, extents);
+	}
+};
+
+// ===================================================================
+// Frustum (6̕ʁB@͓)
+// ===================================================================
+struct Frustum
+{
+	Vector4 planes[6];	// EEEEEOE (ax + by + cz + d >= 0 )
+
+	// r[s ~ vWFNVs񂩂畽ʂo
+	static Frustum FromMatrix(const Matrix& viewProjection)
+	{
+		const Matrix& m = viewProjection;
+		Frustum f;
+		f.planes[0] = Vector4(m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41);	// 
+		f.planes[1] = Vector4(m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41);	// E
+		f.planes[2] = Vector4(m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42);	// 
+		f.planes[3] = Vector4(m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42);	// 
+		f.planes[4] = Vector4(m._13, m._23, m._33, m._43);									// O (Direct3D  z >= 0)
+		f.planes[5] = Vector4(m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43);	// 
+		return f;
+	}
+
+	// {bNXꕔłɂ邩
+	bool Intersects(const Bounds& bounds) const
+	{
+		Vector3 c = bounds.GetCenter();
+		Vector3 e = bounds.GetExtents();
+		for (const Vector4& p : planes)
+		{
+			// ʂ̖@ɍłi񂾒_OȂŜO
+			float distance = p.x * c.x + p.y * c.y + p.z * c.z + p.w;
+			float radius = std::fabs(p.x) * e.x + std::fabs(p.y) * e.y + std::fabs(p.z) * e.z;
+			if (distance + radius < 0.0f) return false;
+		}
+		return true;
+	}
+
+	// {bNXŜɂ邩
+	bool Contains(const Bounds& bounds) const
+	{
+		Vector3 c = bounds.GetCenter();
+		Vector3 e = bounds.GetExtents();
+		for (const Vector4& p : planes)
+		{
+			float distance = p.x * c.x + p.y * c.y + p.z * c.z + p.w;
+			float radius = std::fabs(p.x) * e.x + std::fabs(p.y) * e.y + std::fabs(p.z) * e.z;
+			if (distance - radius < 0.0f) return false;
+		}
+		return true;
+	}
+};
\ No newline at end of file
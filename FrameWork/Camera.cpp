@@ -1,6 +1,9 @@
 #include "Renderer.h"
 #include "Camera.h"
 #include "Application.h"
+#include "Bounds.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace DirectX::SimpleMath;
 
@@ -28,26 +31,62 @@ void Camera::Update()
 void Camera::SetCamera()
 {
 	// r[ϊ쐬
-	Vector3 up = Vector3(0.0f, 1.0f, 0.0f);
-	m_ViewMatrix = DirectX::XMMatrixLookAtLH(m_Position, m_Target, up); //n
+	m_ViewMatrix = CreateViewMatrix();
 
 	Renderer::SetViewMatrix(&m_ViewMatrix);
 
 	//vWFNVs̐
-	constexpr float fieldOfView = DirectX::XMConvertToRadians(45.0f);    // p
-	
+	Matrix projectionMatrix = CreateProjectionMatrix();
+
+	Renderer::SetProjectionMatrix(&projectionMatrix);
+}
+
+//=======================================
+//r[s̍쐬
+//=======================================
+Matrix Camera::CreateViewMatrix() const
+{
+	Vector3 up = Vector3(0.0f, 1.0f, 0.0f);
+	return DirectX::XMMatrixLookAtLH(m_Position, m_Target, up); //n
+}
+
+//=======================================
+//vWFNVs̍쐬
+//=======================================
+Matrix Camera::CreateProjectionMatrix() const
+{
 	float aspectRatio = static_cast<float>(Application::GetWidth()) / static_cast<float>(Application::GetHeight());	// AXyNg	
 	float nearPlane = 1.0f;       // jANbv
 	float farPlane = 1000.0f;      // t@[Nbv
 
-	//vWFNVs̐
-	Matrix projectionMatrix;
-	projectionMatrix =  DirectX::XMMatrixPerspectiveFovLH( fieldOfView,  aspectRatio,  nearPlane,  farPlane);	//n
+	return DirectX::XMMatrixPerspectiveFovLH( FieldOfView,  aspectRatio,  nearPlane,  farPlane);	//n
+}
 
-	Renderer::SetProjectionMatrix(&projectionMatrix);
+//=======================================
+//̎擾
+//=======================================
+Frustum Camera::GetFrustum() const
+{
+	return Frustum::FromMatrix(CreateViewMatrix() * CreateProjectionMatrix());
 }
 
 
+//=======================================
+//ʏ̑傫
+//=======================================
+float Camera::GetScreenSize(const Vector3& center, float radius) const
+{
+	float distance = Vector3::Distance(m_Position, center);
+	if (distance <= radius)
+	{
+		return 1.0f;
+	}
+
+	//  distance ł̉ʂ̍̔ distance * tan(p / 2)
+	static const float tanHalfFov = std::tan(FieldOfView * 0.5f);
+	return std::min(radius / (distance * tanHalfFov), 1.0f);
+}
+
 //=======================================
 //I
 //=======================================
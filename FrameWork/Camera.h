@@ -2,10 +2,15 @@
 
 #include	<SimpleMath.h>
 
+struct Frustum;
+
 //-----------------------------------------------------------------------------
 //CameraNX
 //-----------------------------------------------------------------------------
 class Camera {
+public:
+	static constexpr float FieldOfView = DirectX::XMConvertToRadians(45.0f);	// c̎p
+
 private:
 	DirectX::SimpleMath::Vector3	m_Position = DirectX::SimpleMath::Vector3(0.0f, 0.0f, 0.0f);
 	DirectX::SimpleMath::Vector3	m_Rotation = DirectX::SimpleMath::Vector3(0.0f, 0.0f, 0.0f);
@@ -20,6 +25,14 @@ public:
 	void SetCamera();
 	void Uninit();
 
+	// r[sEvWFNVs쐬 (SetCamera Ɠ)
+	DirectX::SimpleMath::Matrix CreateViewMatrix() const;
+	DirectX::SimpleMath::Matrix CreateProjectionMatrix() const;
+	// 擾 (JOp)
+	Frustum GetFrustum() const;
+	//  (SEa) ʂ̍ɑ΂Đ߂銄 (LOD IpBJ̒Ȃ 1)
+	float GetScreenSize(const DirectX::SimpleMath::Vector3& center, float radius) const;
+
 	// ================================================================== =
 	// ANZT
 	// ===================================================================
@@ -31,6 +31,19 @@ public:
     {
     }
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    // J̓V[̂̂g
+    static constexpr const char* TypeName = "CameraFollowComponent";
+    static constexpr auto ReflectFields()
+    {
+        return std::make_tuple(
+            MakeField("Offset", &CameraFollowComponent::m_Offset),
+            MakeField("FollowSpeed", &CameraFollowComponent::m_FollowSpeed),
+            MakeField("LookAtTarget", &CameraFollowComponent::m_LookAtTarget));
+    }
+
     // ===================================================================
     // 
     // ===================================================================
@@ -30,6 +30,18 @@ public:
     {
     }
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    // J̓V[̂̂g
+    static constexpr const char* TypeName = "CameraRelativeMoverComponent";
+    static constexpr auto ReflectFields()
+    {
+        return std::make_tuple(
+            MakeField("MoveSpeed", &CameraRelativeMoverComponent::m_MoveSpeed),
+            MakeField("RotationSpeed", &CameraRelativeMoverComponent::m_RotationSpeed));
+    }
+
     // ===================================================================
     // XV
     // ===================================================================
@@ -37,7 +49,7 @@ public:
     {
         if (!m_pOwner || !m_Camera) return;
 
-        float deltaTime = Game::GetDeltaTime();
+        float deltaTime = GetDeltaTime();
         Transform& transform = m_pOwner->GetTransform();
 
         using namespace DirectX::SimpleMath;
@@ -52,7 +52,7 @@ public:
     {
         if (!m_Camera || !m_Target) return;
 
-        float deltaTime = Game::GetDeltaTime();
+        float deltaTime = GetDeltaTime();
 
         // L[ŉ]
         if (IO_MANAGER.GetKeyPressKeyBord(VK_LEFT))
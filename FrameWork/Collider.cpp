@@ -40,6 +40,19 @@ void Collider::Uninit()
     PHYSICS_MANAGER.UnregisterCollider(this);
 }
 
+// ===================================================================
+// V[̈ꎞ~EĊJ (~̃V[͏Փ˔̑ΏۊOɂ)
+// ===================================================================
+void Collider::OnSuspend()
+{
+    PHYSICS_MANAGER.UnregisterCollider(this);
+}
+
+void Collider::OnResume()
+{
+    PHYSICS_MANAGER.RegisterCollider(this);
+}
+
 // ===================================================================
 // [hWł̒Sʒu擾
 // ===================================================================
@@ -51,7 +64,7 @@ Vector3 Collider::GetWorldCenter() const
     }
 
     // I[i[̃[hW + [JS + ItZbg
-    const Vector3& ownerPos = m_pOwner->GetTransform().GetPosition();
+    Vector3 ownerPos = m_pOwner->GetTransform().GetWorldPosition();
     return ownerPos + m_Center + m_Offset;
 }
 
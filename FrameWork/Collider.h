@@ -41,6 +41,8 @@ public:
     // ===================================================================
     void Init() override;
     void Uninit() override;
+    void OnSuspend() override;
+    void OnResume() override;
 
     // ===================================================================
     // Փ˔iz֐j
@@ -72,6 +74,17 @@ public:
     // RC_[^Cv
     ColliderType GetType() const { return m_Type; }
 
+    // hNX ReflectFields Ɋ܂߂鋤ʂ̍
+    static constexpr auto ReflectColliderFields()
+    {
+        return std::make_tuple(
+            MakeField("Center", &Collider::m_Center),
+            MakeField("Offset", &Collider::m_Offset),
+            MakeField("IsTrigger", &Collider::m_IsTrigger),
+            MakeField("IsStatic", &Collider::m_IsStatic),
+            MakeField("Layer", &Collider::m_Layer));
+    }
+
     // SEItZbg
     void SetCenter(const Vector3& center) { m_Center = center; }
     const Vector3& GetCenter() const { return m_Center; }
@@ -4,6 +4,8 @@
 // ===================================================================
 #pragma once
 #include "SystemCommon.h"
+#include "UpdateScheduler.h"
+#include "ComponentReflection.h"
 
 // ===================================================================
 // O錾
@@ -23,6 +25,11 @@ protected:
     GameObject* m_pOwner = nullptr;  // ̃R|[lgLGameObject
     bool m_Enabled = true;            // R|[lgLǂ
 
+    // XVpx (Update LOD)
+    UpdateRate m_UpdateRate = UpdateRate::EveryFrame;  // XVpx̎w
+    float m_DeltaTime = 0.0f;         // ̍XVŐi߂鎞
+    float m_PendingTime = 0.0f;       // XVԈĂԂɗ܂
+
 public:
     // ===================================================================
     // RXgN^EfXgN^
@@ -46,6 +53,40 @@ public:
     // I
     virtual void Uninit() {}
 
+    // ėp̏ (v[ēxoꂽɌĂ΂BԂlɖ߂)
+    virtual void OnReuse() {}
+
+    // 풓V[̈ꎞ~EĊJ̏ (OVXeւ̓o^̉Eēo^Ȃ)
+    virtual void OnSuspend() {}
+    virtual void OnResume() {}
+
+    // ===================================================================
+    // XVpx (Update LOD)
+    // ===================================================================
+
+    // XVpxݒ (DistanceBased ɂƃJ牓ɊԈ)
+    void SetUpdateRate(UpdateRate rate) { m_UpdateRate = rate; }
+    UpdateRate GetUpdateRate() const { return m_UpdateRate; }
+
+    // oߎԂnčXV (GameObject Ă΂BԈꂽt[͎Ԃ𗭂߂Ă)
+    void Tick(float deltaTime, bool lodDue)
+    {
+        m_PendingTime += deltaTime;
+        if (m_UpdateRate == UpdateRate::EveryFrame || lodDue)
+        {
+            m_DeltaTime = m_PendingTime;
+            m_PendingTime = 0.0f;
+            Update();
+        }
+    }
+
+    // ܂Ԃ̂Ă (ėpEĊJ GameObject Ă΂BO̎ԂzȂ)
+    void ResetTime()
+    {
+        m_DeltaTime = 0.0f;
+        m_PendingTime = 0.0f;
+    }
+
     // ===================================================================
     // I[i[ (GameObject) ̐ݒE擾
     // ===================================================================
@@ -57,6 +98,11 @@ public:
     GameObject* GetOwner() { return m_pOwner; }
     const GameObject* GetOwner() const { return m_pOwner; }
 
+protected:
+    // ̍XVŐi߂鎞 (ԈĂ܂ށBUpdate ł Game::GetDeltaTime ł͂Ȃg)
+    float GetDeltaTime() const { return m_DeltaTime; }
+
+public:
     // ===================================================================
     // LE̐
     // ===================================================================
@@ -0,0 +1,300 @@
+// ===================================================================
+// ComponentCodec.cpp
+// R|[lg̃Xe[WۑEǂݍݕ\̐
+// ===================================================================
+#include "ComponentCodec.h"
+#include "GameObject.h"
+#include "XmlRW.h"
+
+#include <charconv>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// R|[lg (ComponentTypeList ̑SĂ̌^ĂKv)
+#include "RigidBody.h"
+#include "AABBCollider.h"
+#include "SphereCollider.h"
+#include "Renderer2DComponent.h"
+#include "RotatorComponent.h"
+#include "PlayerMoverComponent.h"
+#include "CameraFollowComponent.h"
+#include "CameraRotatorComponent.h"
+#include "CameraRelativeMoverComponent.h"
+#include "MeshComponentWrapper.h"
+
+namespace
+{
+	// ===================================================================
+	// l  
+	// ===================================================================
+	template<typename T>
+	bool ParseValue(std::string_view text, T& value)
+	{
+		while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+		while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) text.remove_suffix(1);
+		if (!text.empty() && text.front() == '+') text.remove_prefix(1);	// from_chars  '+' ǂ܂Ȃ
+
+		T parsed{};
+		auto result = std::from_chars(text.data(), text.data() + text.size(), parsed);
+		if (result.ec != std::errc() || result.ptr != text.data() + text.size()) return false;
+		value = parsed;
+		return true;
+	}
+
+	template<typename T>
+	std::string FormatValue(T value)
+	{
+		char buffer[32];
+		auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);	// ǂݖ߂ēlɂȂŒZ̕\L
+		return std::string(buffer, result.ptr);
+	}
+
+	// ===================================================================
+	// tB[ȟ^Ƃ̕ϊ
+	// suffix ͑tB[hc (Vector3  X/Y/Z Ȃ)
+	// ===================================================================
+	template<typename T>
+	struct FieldCodec;
+
+	template<typename T>
+		requires std::is_same_v<T, float> || std::is_same_v<T, int>
+	struct FieldCodec<T>
+	{
+		static bool Read(T& value, std::string_view suffix, std::string_view text)
+		{
+			return suffix.empty() && ParseValue(text, value);
+		}
+		static void Write(const T& value, const char* name, ComponentData& data)
+		{
+			data.attributes.emplace_back(name, FormatValue(value));
+		}
+	};
+
+	template<>
+	struct FieldCodec<bool>
+	{
+		static bool Read(bool& value, std::string_view suffix, std::string_view text)
+		{
+			if (!suffix.empty()) return false;
+			if (text == "true" || text == "1")	{ value = true;	 return true; }
+			if (text == "false" || text == "0")	{ value = false; return true; }
+			return false;
+		}
+		static void Write(const bool& value, const char* name, ComponentData& data)
+		{
+			data.attributes.emplace_back(name, value ? "true" : "false");
+		}
+	};
+
+	template<>
+	struct FieldCodec<std::string>
+	{
+		static bool Read(std::string& value, std::string_view suffix, std::string_view text)
+		{
+			if (!suffix.empty()) return false;
+			value = text;
+			return true;
+		}
+		static void Write(const std::string& value, const char* name, ComponentData& data)
+		{
+			data.attributes.emplace_back(name, value);
+		}
+	};
+
+	// vfƂɑ𕪂^ (Vector3  NameX/NameY/NameZ, Color  NameR/NameG/NameB/NameA)
+	template<size_t N>
+	bool ReadElement(float* const (&elements)[N], const char* const (&suffixes)[N],
+		std::string_view suffix, std::string_view text)
+	{
+		for (size_t i = 0; i < N; i++)
+		{
+			if (suffix == suffixes[i]) return ParseValue(text, *elements[i]);
+		}
+		return false;
+	}
+
+	template<size_t N>
+	void WriteElements(const float (&elements)[N], const char* const (&suffixes)[N],
+		const char* name, ComponentData& data)
+	{
+		for (size_t i = 0; i < N; i++)
+		{
+			data.attributes.emplace_back(std::string(name) + suffixes[i], FormatValue(elements[i]));
+		}
+	}
+
+	template<>
+	struct FieldCodec<Vector3>
+	{
+		static constexpr const char* Suffixes[] = { "X", "Y", "Z" };
+
+		static bool Read(Vector3& value, std::string_view suffix, std::string_view text)
+		{
+			float* const elements[] = { &value.x, &value.y, &value.z };
+			return ReadElement(elements, Suffixes, suffix, text);
+		}
+		static void Write(const Vector3& value, const char* name, ComponentData& data)
+		{
+			const float elements[] = { value.x, value.y, value.z };
+			WriteElements(elements, Suffixes, name, data);
+		}
+	};
+
+	template<>
+	struct FieldCodec<Color>
+	{
+		static constexpr const char* Suffixes[] = { "R", "G", "B", "A" };
+
+		static bool Read(Color& value, std::string_view suffix, std::string_view text)
+		{
+			float* const elements[] = { &value.x, &value.y, &value.z, &value.w };
+			return ReadElement(elements, Suffixes, suffix, text);
+		}
+		static void Write(const Color& value, const char* name, ComponentData& data)
+		{
+			const float elements[] = { value.x, value.y, value.z, value.w };
+			WriteElements(elements, Suffixes, name, data);
+		}
+	};
+
+	// ===================================================================
+	// ^Ƃ̊֐ (ComponentCodec ɓ)
+	// ===================================================================
+	template<typename T>
+	Component* AddReflected(GameObject* object, const ComponentLoadContext& context)
+	{
+		if (T* component = object->GetComponent<T>()) return component;
+
+		if constexpr (std::is_constructible_v<T, Camera*>)
+		{
+			return object->AddComponent<T>(context.camera);
+		}
+		else
+		{
+			return object->AddComponent<T>();
+		}
+	}
+
+	template<typename T>
+	Component* GetReflected(GameObject* object)
+	{
+		return object->GetComponent<T>();
+	}
+
+	template<typename T>
+	bool ReadReflected(Component* component, std::string_view name, std::string_view value)
+	{
+		T& target = *static_cast<T*>(component);
+
+		// tB[hŎn܂̂T (c͗vf̐ڔ)
+		return std::apply([&](const auto&... fields)
+		{
+			auto readField = [&](const auto& field)
+			{
+				std::string_view fieldName(field.name);
+				if (!name.starts_with(fieldName)) return false;
+
+				using Value = typename std::remove_cvref_t<decltype(field)>::Value;
+				return FieldCodec<Value>::Read(target.*field.member, name.substr(fieldName.size()), value);
+			};
+			return (readField(fields) || ...);
+		}, T::ReflectFields());
+	}
+
+	template<typename T>
+	void WriteReflected(const Component* component, ComponentData& data)
+	{
+		const T& source = *static_cast<const T*>(component);
+
+		data.type = T::TypeName;
+		data.attributes.clear();
+		std::apply([&](const auto&... fields)
+		{
+			auto writeField = [&](const auto& field)
+			{
+				using Value = typename std::remove_cvref_t<decltype(field)>::Value;
+				FieldCodec<Value>::Write(source.*field.member, field.name, data);
+			};
+			(writeField(fields), ...);
+		}, T::ReflectFields());
+	}
+
+	// ===================================================================
+	// \̐ (ReflectFields 錾Ă^)
+	// ===================================================================
+	template<typename T>
+	void AppendCodec(std::vector<ComponentCodec>& codecs)
+	{
+		if constexpr (ReflectableComponent<T>)
+		{
+			codecs.push_back({
+				T::TypeName,
+				ComponentBit<T>(),
+				&AddReflected<T>,
+				&GetReflected<T>,
+				&ReadReflected<T>,
+				&WriteReflected<T> });
+		}
+	}
+
+	template<typename... Ts>
+	std::vector<ComponentCodec> MakeCodecTable(TypeList<Ts...>)
+	{
+		std::vector<ComponentCodec> codecs;
+		(AppendCodec<Ts>(codecs), ...);
+		return codecs;
+	}
+
+	const std::vector<ComponentCodec>& GetCodecTable()
+	{
+		static const std::vector<ComponentCodec> codecs = MakeCodecTable(ComponentTypeList{});
+		return codecs;
+	}
+}
+
+// ===================================================================
+// ۑłR|[lg̈ꗗ
+// ===================================================================
+std::span<const ComponentCodec> GetComponentCodecs()
+{
+	return GetCodecTable();
+}
+
+// ===================================================================
+// ^
+// ===================================================================
+const ComponentCodec* FindComponentCodec(std::string_view typeName)
+{
+	static const std::unordered_map<std::string_view, const ComponentCodec*> index = []
+	{
+		std::unordered_map<std::string_view, const ComponentCodec*> map;
+		for (const ComponentCodec& codec : GetCodecTable())
+		{
+			map.emplace(codec.typeName, &codec);
+		}
+		return map;
+	}();
+
+	auto it = index.find(typeName);
+	return it != index.end() ? it->second : nullptr;
+}
+
+// ===================================================================
+// ۑłR|[lg̃rbg̏W
+// ===================================================================
+ComponentMask GetReflectedComponentMask()
+{
+	static const ComponentMask mask = []
+	{
+		ComponentMask bits = 0;
+		for (const ComponentCodec& codec : GetCodecTable())
+		{
+			bits |= codec.bit;
+		}
+		return bits;
+	}();
+	return mask;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+// ===================================================================
+// ComponentCodec.h
+// R|[lg̃Xe[WۑEǂݍ
+// ReflectFields 錾ĂR|[lg^ƂɁAComponentTypeList \𐶐
+// (^̕r dynamic_cast Ō^TȂ)
+// ===================================================================
+#pragma once
+#include <span>
+#include <string_view>
+
+#include "ComponentTypeId.h"
+
+// ===================================================================
+// O錾
+// ===================================================================
+class Camera;
+class Component;
+class GameObject;
+struct ComponentData;
+
+// R|[lg̐ɕKvȃV[̏
+struct ComponentLoadContext
+{
+	Camera* camera = nullptr;	// RXgN^ Camera* R|[lgɓn
+};
+
+// ===================================================================
+// ^Ƃ̕ϊ֐
+// ===================================================================
+struct ComponentCodec
+{
+	const char* typeName;	// xml  <Component Type="...">
+	ComponentMask bit;		// ^̃rbg (GameObject::GetComponentMask Ɣr)
+
+	// ǉ (ɎĂ΂Ԃ)
+	Component* (*add)(GameObject* object, const ComponentLoadContext& context);
+	// 擾 (ĂȂ nullptr)
+	Component* (*get)(GameObject* object);
+	// 1f (YtB[hElǂ߂Ȃ false)
+	bool (*readAttribute)(Component* component, std::string_view name, std::string_view value);
+	// StB[ho (data.type ݒ肷)
+	void (*write)(const Component* component, ComponentData& data);
+};
+
+// ۑłR|[lg̈ꗗ (ComponentTypeList ̏)
+std::span<const ComponentCodec> GetComponentCodecs();
+// ^ (Ȃ nullptr)
+const ComponentCodec* FindComponentCodec(std::string_view typeName);
+// ۑłR|[lg̃rbg̏W
+ComponentMask GetReflectedComponentMask();
\ No newline at end of file
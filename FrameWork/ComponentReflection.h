@@ -0,0 +1,48 @@
+// ===================================================================
+// ComponentReflection.h
+// R|[lgۑΏۂ̃tB[h錾邽߂̎dg
+// Xe[Wւ̕ۑEǂݍ݂ ComponentCodec ̐錾^Ƃɐ
+//
+// 錾̗ (NXɏBprivate owł)
+//   static constexpr const char* TypeName = "Rigidbody";	// xml  <Component Type="..."> ɎgO
+//   static constexpr auto ReflectFields()
+//   {
+//       return std::make_tuple(
+//           MakeField("Mass", &Rigidbody::m_Mass),
+//           MakeField("UseGravity", &Rigidbody::m_UseGravity));
+//   }
+//
+// gtB[ȟ^: float, int, bool, Vector3, Color, std::string
+//  ComponentTypeList (ComponentTypeId.h) ɓo^Ă邱
+// ===================================================================
+#pragma once
+#include <concepts>
+#include <tuple>
+
+// ===================================================================
+// tB[h (Oƃoւ̃|C^)
+// ===================================================================
+template<typename C, typename T>
+struct ReflectField
+{
+	using Value = T;
+
+	const char* name;	// xml ̑ (Vector3 ͖ X/Y/ZAColor  R/G/B/A tĕۑ)
+	T C::* member;		// oւ̃|C^
+};
+
+template<typename C, typename T>
+constexpr ReflectField<C, T> MakeField(const char* name, T C::* member)
+{
+	return { name, member };
+}
+
+// ===================================================================
+// ۑΏۂ̃tB[h錾Ă邩
+// ===================================================================
+template<typename T>
+concept ReflectableComponent = requires
+{
+	{ T::TypeName } -> std::convertible_to<const char*>;
+	T::ReflectFields();
+};
\ No newline at end of file
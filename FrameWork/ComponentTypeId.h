@@ -0,0 +1,106 @@
+// ===================================================================
+// ComponentTypeId.h
+// R|[lǧ^ƂɃRpC̘AIDU
+// GameObject ͂IDŌŒ蒷ẑŁAɃnbVRTTIgȂ
+//  VR|[lg ComponentTypeList ɒǉ邱
+// ===================================================================
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// ===================================================================
+// O錾
+// ===================================================================
+class Rigidbody;
+class Collider;
+class AABBCollider;
+class SphereCollider;
+class Renderer2DComponent;
+class RotatorComponent;
+class PlayerMoverComponent;
+class CameraFollowComponent;
+class CameraRotatorComponent;
+class CameraRelativeMoverComponent;
+class SimpleCubeRendererComponent;
+class SimplePlaneRendererComponent;
+class MeshRendererComponent;
+class EmptyRender;
+// Add Forward Declaration
+
+// ===================================================================
+// ^Xg
+// ===================================================================
+template<typename... Ts>
+struct TypeList
+{
+	static constexpr size_t Count = sizeof...(Ts);
+};
+
+// ^Xg̈ʒu (Ȃ Count)
+template<typename T, typename List>
+struct TypeListIndex;
+
+template<typename T>
+struct TypeListIndex<T, TypeList<>> : std::integral_constant<size_t, 0> {};
+
+template<typename T, typename... Ts>
+struct TypeListIndex<T, TypeList<T, Ts...>> : std::integral_constant<size_t, 0> {};
+
+template<typename T, typename U, typename... Ts>
+struct TypeListIndex<T, TypeList<U, Ts...>>
+	: std::integral_constant<size_t, 1 + TypeListIndex<T, TypeList<Ts...>>::value> {};
+
+// ===================================================================
+// R|[lg^̈ꗗ (я̂܂IDɂȂ)
+// ===================================================================
+using ComponentTypeList = TypeList<
+	Rigidbody,
+	Collider,
+	AABBCollider,
+	SphereCollider,
+	Renderer2DComponent,
+	RotatorComponent,
+	PlayerMoverComponent,
+	CameraFollowComponent,
+	CameraRotatorComponent,
+	CameraRelativeMoverComponent,
+	SimpleCubeRendererComponent,
+	SimplePlaneRendererComponent,
+	MeshRendererComponent,
+	EmptyRender
+	// Add Component
+>;
+
+// o^ĂR|[lg^̐
+constexpr size_t ComponentTypeCount = ComponentTypeList::Count;
+
+// R|[lg̏W (1^ɂ1rbg)
+using ComponentMask = uint64_t;
+static_assert(ComponentTypeCount <= 64, "ComponentMask supports up to 64 component types");
+
+// ===================================================================
+// ^  ID
+// ===================================================================
+template<typename T>
+constexpr size_t ComponentTypeId()
+{
+	constexpr size_t id = TypeListIndex<std::remove_cv_t<T>, ComponentTypeList>::value;
+	static_assert(id < ComponentTypeCount,
+		"Component type is not registered. Add it to ComponentTypeList in ComponentTypeId.h");
+	return id;
+}
+
+// ^  rbg
+template<typename T>
+constexpr ComponentMask ComponentBit()
+{
+	return ComponentMask(1) << ComponentTypeId<T>();
+}
+
+// ̌^  rbg̏W
+template<typename... Ts>
+constexpr ComponentMask ComponentBits()
+{
+	return (ComponentMask(0) | ... | ComponentBit<Ts>());
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+// ===================================================================
+// FileWatcher.cpp
+// t@CXV̊Ď
+// ===================================================================
+#include "FileWatcher.h"
+
+namespace fs = std::filesystem;
+
+// ===================================================================
+// t@CĎΏۂɒǉ
+// ===================================================================
+void FileWatcher::Watch(const std::string& path)
+{
+	std::error_code ec;
+	WatchedFile file;
+	file.writeTime = fs::last_write_time(path, ec);
+	m_Files[path] = file;
+}
+
+// ===================================================================
+// fBNg̃t@C܂Ƃ߂ĊĎΏۂɒǉ
+// ===================================================================
+void FileWatcher::WatchDirectory(const std::string& directory, const std::string& extension)
+{
+	std::error_code ec;
+	for (const auto& entry : fs::directory_iterator(directory, ec))
+	{
+		if (entry.is_regular_file(ec) && entry.path().extension() == extension)
+		{
+			Watch(entry.path().generic_string());
+		}
+	}
+}
+
+// ===================================================================
+// XVꂽt@C𒲂ׂ
+// ===================================================================
+std::vector<std::string> FileWatcher::Poll(float deltaTime)
+{
+	std::vector<std::string> changed;
+
+	m_Elapsed += deltaTime;
+	if (m_Elapsed < m_Interval) return changed;
+	m_Elapsed = 0.0f;
+
+	for (auto& [path, file] : m_Files)
+	{
+		// 폜Euœǂ߂Ȃꍇ͎̊mFɉ
+		std::error_code ec;
+		auto writeTime = fs::last_write_time(path, ec);
+		if (ec) continue;
+
+		if (writeTime != file.writeTime)
+		{
+			// ύXoB̊mF܂ŕςȂΒʒm
+			file.writeTime = writeTime;
+			file.pending = true;
+		}
+		else if (file.pending)
+		{
+			file.pending = false;
+			changed.push_back(path);
+		}
+	}
+	return changed;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+// ===================================================================
+// FileWatcher.h
+// t@C̍XVĎ (XVԊuŒׂ)
+// ݓrœǂ܂Ȃ悤AXV1񕪂̊ԊuςȂȂĂʒm
+// ===================================================================
+#pragma once
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class FileWatcher
+{
+private:
+	struct WatchedFile
+	{
+		std::filesystem::file_time_type writeTime;	// ŌɊmFXV
+		bool pending = false;						// ύXoė̂҂Ă
+	};
+
+	std::unordered_map<std::string, WatchedFile> m_Files;	// pXň
+	float m_Interval = 0.5f;	// mFԊu (b)
+	float m_Elapsed = 0.0f;		// O̊mF̌oߎ
+
+public:
+	// t@CĎΏۂɒǉ (݂̍XVɂ)
+	void Watch(const std::string& path);
+	// fBNg̎wgq̃t@CׂĊĎΏۂɒǉ (gq ".xml" ̌`)
+	void WatchDirectory(const std::string& directory, const std::string& extension);
+	// ĎΏۂO
+	void Unwatch(const std::string& path) { m_Files.erase(path); }
+	void Clear() { m_Files.clear(); }
+
+	// mFԊuݒ (b)
+	void SetInterval(float seconds) { m_Interval = seconds; }
+
+	// oߎԂi߁AXVꂽt@C̃pXԂ (t[Ă)
+	std::vector<std::string> Poll(float deltaTime);
+};
\ No newline at end of file
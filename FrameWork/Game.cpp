@@ -10,6 +10,7 @@
 #include "SoundManager.h"
 #include "IOManager.h"
 #include "PhysicsManager.h"
+#include "ThreadPool.h"
 
 //=======================================
 // O[oϐ
@@ -44,6 +45,9 @@ void Game::Init()
 	// `I
 	Renderer::Init();
 
+	// [J[XbhNiV[̔񓯊ǂݍݗpj
+	THREAD_POOL.Init();
+
 	// }l[W[NX
 	PHYSICS_MANAGER.Init();
 	SCENE_MANAGER.Init();
@@ -67,17 +71,29 @@ void Game::Update()
 	g_TotalTime = m_Timer.GetTotalTime();
 	g_CurrentFPS = m_Timer.GetFPS();
 
+	// 񓯊ǂݍ݂I\[XGPU] (1t[̏ԓ)
+	M_RESOURCE.ProcessUploads();
+
 	// V[ύX
 	SCENE_MANAGER.ChangeScene();
 
+	// \Z𒴂Ă΁AÕV[ŎgI\[X̂Ă
+	M_RESOURCE.Trim();
+
 	// ͍XV
 	IO_MANAGER.Update();
 
 	// ZEՓ˔
 	PHYSICS_MANAGER.Update();
 
+	// _FՓ˃R[obNŗ\񂳂ꂽE폜𔽉f
+	SCENE_MANAGER.FlushCommands();
+
 	// }l[W[NXXV
 	SCENE_MANAGER.Update();
+
+	// _FXVɗ\񂳂ꂽE폜𔽉f
+	SCENE_MANAGER.FlushCommands();
 }
 
 // `
@@ -96,6 +112,9 @@ void Game::Draw()
 // I
 void Game::Uninit()
 {
+	// [J[Xbh~iǂݍݒ̃^XNe}l[W[ĝŐɎ~߂j
+	THREAD_POOL.UnInit();
+
 	// }l[W[NXI
 	IO_MANAGER.UnInit();
 	SOUND_MANAGER.UnInit();
@@ -6,13 +6,15 @@
 #include <vector>
 #include <memory>
 #include <string>
-#include <typeindex>
-#include <unordered_map>
+#include <array>
 
 #include "Transform.h"
 #include "Component.h"
 #include "MeshComponent.h"
 #include "Camera.h"
+#include "GameObjectRegistry.h"
+#include "SceneArena.h"
+#include "ComponentTypeId.h"
 
 // ===================================================================
 // GameObject NX
@@ -29,30 +31,52 @@ protected:
     Transform m_Transform;
 
     // R|[lgǗ
-    std::vector<std::unique_ptr<Component>> m_Components;  // R|[lgXg
-    std::vector<std::unique_ptr<MeshComponent>> m_MeshComponents;     // 3DbVR|[lg
-    std::unordered_map<std::type_index, Component*> m_ComponentMap;  // ^R|[lgւ̍p
-    std::unordered_map<std::type_index, MeshComponent*> m_MeshComponentMap;  // ^R|[lgւ̍p
+    std::vector<PoolPtr<Component>> m_Components;  // R|[lgXg
+    std::vector<PoolPtr<MeshComponent>> m_MeshComponents;     // 3DbVR|[lg
+    std::array<Component*, ComponentTypeCount> m_ComponentSlots{};  // ^IDR|[lgւ̍p (bV܂)
+    ComponentMask m_ComponentMask = 0;                              // ĂR|[lǧ^ID̃rbg
 
     bool m_Active;      // GameObject Lǂ
     int m_id = -1;   // IDiݒj
-    std::string m_Name = "";    // GameObject 
-    std::string m_Tag = "";      // GameObject ʂ邽߂̃^O
+    StringId m_Name = StringId::Intern("");    // GameObject 
+    StringId m_Tag = StringId::Intern("");      // GameObject ʂ邽߂̃^O
+
+    // V[ւ̓o^ (GameObjectRegistry ݒ肷)
+    GameObjectRegistry* m_pRegistry = nullptr;  // o^ (o^Ȃnullptr)
+    GameObjectHandle m_Handle;                  // o^ɔsꂽnh
+
+    // R|[lg̊mې (nullptrȂʏ new)
+    SceneArena* m_pArena = nullptr;
+
+    // Prefabԍ (Prefab琶ĂȂ-1)
+    int m_PrefabId = -1;
+    // Prefab̑ҋ@XgɓĂ邩 (SceneBase::DespawnŐݒASpawnŉ)
+    bool m_InPool = false;
+
+    // ԃCfbNX (LooseOctree) ̓o^ID (o^Ȃ-1)
+    int m_SpatialId = -1;
+
+    // ԈXV̈ʑ (UpdateScheduler 蓖ĂB蓖ĂȂ-1)
+    int m_UpdatePhase = -1;
+
+    friend class GameObjectRegistry;
 
 public:
     // ===================================================================
     // RXgN^EfXgN^
     // ===================================================================
     GameObject()
-        : m_Active(true)
-        , m_Tag(""){}
+        : m_Active(true){}
 
     GameObject(Vector3 pos, Vector3 rotate, Vector3 scale)
-        : m_Active(true)
-        , m_Tag("") 
-        , m_Transform(pos, rotate, scale){}
+        : m_Transform(pos, rotate, scale)
+        , m_Active(true){}
 
-    virtual ~GameObject() = default;
+    virtual ~GameObject()
+    {
+        // o^ꂽ܂ܔjꂽꍇ͍O
+        if (m_pRegistry) m_pRegistry->Unregister(this);
+    }
 
     // ===================================================================
     // R|[lgǗ
@@ -67,14 +91,14 @@ public:
             "T must be derived from Component");
 
         // VR|[lg쐬
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
+        PoolPtr<T> component = CreateComponent<T>(std::forward<Args>(args)...);
         T* ptr = component.get();
 
         // I[i[(this) ݒ
         ptr->SetOwner(this);
 
         // }bvɓo^(^獂ł悤)
-        m_ComponentMap[std::type_index(typeid(T))] = ptr;
+        SetComponentSlot<T>(ptr);
 
         // Xgɒǉ
         m_Components.push_back(std::move(component));
@@ -96,14 +120,14 @@ public:
         // TODO:IuWFNg폜
 
         // VR|[lg쐬
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
+        PoolPtr<T> component = CreateComponent<T>(std::forward<Args>(args)...);
         T* ptr = component.get();
 
         // I[i[(this) ݒ
         ptr->SetOwner(this);
 
         // }bvɓo^(^獂ł悤)
-        m_MeshComponentMap[std::type_index(typeid(T))] = ptr;
+        SetComponentSlot<T>(ptr);
 
         // Xgɒǉ
         m_MeshComponents.push_back(std::move(component));
@@ -111,9 +135,20 @@ public:
         // 
         ptr->Init();
 
+        // `󂪕ς̂ŋE{bNXXV
+        MarkBoundsDirty();
+
         return ptr;
     }
 
+    // ===================================================================
+    // A[i
+    // ===================================================================
+
+    // R|[lg̊mېݒ (SceneBaseɐݒ肷)
+    void SetArena(SceneArena* arena) { m_pArena = arena; }
+    SceneArena* GetArena() const { return m_pArena; }
+
     // ===================================================================
     // R|[lg擾 (ev[g)
     // ===================================================================
@@ -124,14 +159,8 @@ public:
         static_assert(std::is_base_of<Component, T>::value,
             "T must be derived from Component");
 
-        // }bv獂
-        auto it = m_ComponentMap.find(std::type_index(typeid(T)));
-        if (it != m_ComponentMap.end())
-        {
-            return static_cast<T*>(it->second);
-        }
-
-        return nullptr;
+        // ^IDŔz𒼐ڈ
+        return static_cast<T*>(m_ComponentSlots[ComponentTypeId<T>()]);
     }
 
     template<typename T>    // T=擾R|[lǧ^
@@ -141,14 +170,8 @@ public:
         static_assert(std::is_base_of<MeshComponent, T>::value,
             "T must be derived from Component");
 
-        // }bv獂
-        auto it = m_MeshComponentMap.find(std::type_index(typeid(T)));
-        if (it != m_MeshComponentMap.end())
-        {
-            return static_cast<T*>(it->second);
-        }
-
-        return nullptr;
+        // ^IDŔz𒼐ڈ
+        return static_cast<T*>(m_ComponentSlots[ComponentTypeId<T>()]);
     }
 
     // ===================================================================
@@ -161,14 +184,8 @@ public:
         static_assert(std::is_base_of<Component, T>::value,
             "T must be derived from Component");
 
-        // }bv獂
-        auto it = m_ComponentMap.find(std::type_index(typeid(T)));
-        if (it != m_ComponentMap.end())
-        {
-            return static_cast<const T*>(it->second);
-        }
-
-        return nullptr;
+        // ^IDŔz𒼐ڈ
+        return static_cast<const T*>(m_ComponentSlots[ComponentTypeId<T>()]);
     }
 
     template<typename T>
@@ -178,16 +195,24 @@ public:
         static_assert(std::is_base_of<MeshComponent, T>::value,
             "T must be derived from Component");
 
-        // }bv獂
-        auto it = m_MeshComponentMap.find(std::type_index(typeid(T)));
-        if (it != m_MeshComponentMap.end())
-        {
-            return static_cast<const T*>(it->second);
-        }
+        // ^IDŔz𒼐ڈ
+        return static_cast<const T*>(m_ComponentSlots[ComponentTypeId<T>()]);
+    }
 
-        return nullptr;
+    // ===================================================================
+    // R|[lg`FbN
+    // ===================================================================
+    // w肵^̃R|[lgSĎĂ邩 (rbgZ1)
+    template<typename... Ts>
+    bool HasComponents() const
+    {
+        constexpr ComponentMask mask = ComponentBits<Ts...>();
+        return (m_ComponentMask & mask) == mask;
     }
 
+    // ĂR|[lg̃rbg擾
+    ComponentMask GetComponentMask() const { return m_ComponentMask; }
+
     // ===================================================================
     // R|[lg폜
     // ===================================================================
@@ -198,18 +223,19 @@ public:
         static_assert(std::is_base_of<Component, T>::value,
             "T must be derived from Component");
 
-        // }bv폜
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_ComponentMap.find(typeIndex);
-        if (it != m_ComponentMap.end())
+        // p̔z񂩂폜
+        Component* compPtr = m_ComponentSlots[ComponentTypeId<T>()];
+        if (compPtr)
         {
-            Component* compPtr = it->second;
-            m_ComponentMap.erase(it);
+            SetComponentSlot<T>(nullptr);
+
+            // I (ColliderOւ̓o^)
+            compPtr->Uninit();
 
             // Xg폜
             m_Components.erase(
                 std::remove_if(m_Components.begin(), m_Components.end(),
-                    [compPtr](const std::unique_ptr<Component>& comp) {
+                    [compPtr](const PoolPtr<Component>& comp) {
                         return comp.get() == compPtr;
                     }),
                 m_Components.end()
@@ -224,22 +250,25 @@ public:
         static_assert(std::is_base_of<MeshComponent, T>::value,
             "T must be derived from Component");
 
-        // }bv폜
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_MeshComponentMap.find(typeIndex);
-        if (it != m_MeshComponentMap.end())
+        // p̔z񂩂폜
+        Component* compPtr = m_ComponentSlots[ComponentTypeId<T>()];
+        if (compPtr)
         {
-            MeshComponent* compPtr = it->second;
-            m_MeshComponentMap.erase(it);
+            SetComponentSlot<T>(nullptr);
+
+            // I
+            compPtr->Uninit();
 
             // Xg폜
             m_MeshComponents.erase(
                 std::remove_if(m_MeshComponents.begin(), m_MeshComponents.end(),
-                    [compPtr](const std::unique_ptr<MeshComponent>& comp) {
+                    [compPtr](const PoolPtr<MeshComponent>& comp) {
                         return comp.get() == compPtr;
                     }),
                 m_MeshComponents.end()
             );
+
+            MarkBoundsDirty();
         }
     }
 
@@ -248,7 +277,8 @@ public:
     // ===================================================================
     
     // XV
-    virtual void Update()
+    // deltaTime: oߎ / lodDue: ԈΏۂ̃R|[lg̃t[ōXV邩
+    virtual void Update(float deltaTime, bool lodDue = true)
     {
         // GameObject͉̎Ȃ
         if (!m_Active) return;
@@ -258,7 +288,7 @@ public:
         {
             if (component->IsEnabled())
             {
-                component->Update();
+                component->Tick(deltaTime, lodDue);
             }
         }
 
@@ -266,7 +296,7 @@ public:
         {
             if (meshComponent->IsEnabled())
             {
-                meshComponent->Update();
+                meshComponent->Tick(deltaTime, lodDue);
             }
         }
     }
@@ -302,6 +332,51 @@ public:
         }
     }
 
+    // ėp̏ (Prefab̃v[oꂽɌĂ΂)
+    virtual void OnReuse()
+    {
+        // plɖ߂
+        m_Transform.Reset();
+
+        // ׂẴR|[lg̏Ԃ߂ (ԈXVŗ܂Ԃ̂Ă)
+        for (auto& component : m_Components)
+        {
+            component->ResetTime();
+            component->OnReuse();
+        }
+        for (auto& meshComponent : m_MeshComponents)
+        {
+            meshComponent->ResetTime();
+            meshComponent->OnReuse();
+        }
+    }
+
+    // 풓V[̈ꎞ~EĊJ̏
+    virtual void OnSuspend()
+    {
+        for (auto& component : m_Components)
+        {
+            component->OnSuspend();
+        }
+        for (auto& meshComponent : m_MeshComponents)
+        {
+            meshComponent->OnSuspend();
+        }
+    }
+    virtual void OnResume()
+    {
+        for (auto& component : m_Components)
+        {
+            component->ResetTime();
+            component->OnResume();
+        }
+        for (auto& meshComponent : m_MeshComponents)
+        {
+            meshComponent->ResetTime();
+            meshComponent->OnResume();
+        }
+    }
+
     // I
     virtual void Uninit()
     {
@@ -317,9 +392,9 @@ public:
 
         // Xgƃ}bvNA
         m_Components.clear();
-        m_ComponentMap.clear();
         m_MeshComponents.clear();
-        m_MeshComponentMap.clear();
+        m_ComponentSlots.fill(nullptr);
+        m_ComponentMask = 0;
     }
 
     // ===================================================================
@@ -329,6 +404,12 @@ public:
     Transform& GetTransform() { return m_Transform; }
     const Transform& GetTransform() const { return m_Transform; }
 
+    // eGameObjectݒ (nullptrŉ)
+    void SetParent(GameObject* parent, bool keepWorld = false)
+    {
+        m_Transform.SetParent(parent ? &parent->GetTransform() : nullptr, keepWorld);
+    }
+
     // ===================================================================
     // ANeBu
     // ===================================================================
@@ -351,16 +432,108 @@ public:
     // IuWFNg
     // ===================================================================
     // IuWFNgݒ
-    void SetName(const std::string& name) { m_Name = name; }
+    void SetName(const std::string& name)
+    {
+        StringId newName = StringId::Intern(name);
+        if (newName == m_Name) return;
+
+        if (m_pRegistry) m_pRegistry->OnNameChanged(this, m_Name, newName);
+        m_Name = newName;
+    }
     // IuWFNg擾
-    const std::string& GetName() const { return m_Name; }
+    const std::string& GetName() const { return m_Name.GetString(); }
+    StringId GetNameId() const { return m_Name; }
 
     // ===================================================================
     // ^O
     // ===================================================================
     
-    // ^Oݒ
-    void SetTag(const std::string& tag) { m_Tag = tag; }
+    // ^Oݒ (o^ȂV[̃^OXV)
+    void SetTag(const std::string& tag)
+    {
+        StringId newTag = StringId::Intern(tag);
+        if (newTag == m_Tag) return;
+
+        if (m_pRegistry) m_pRegistry->OnTagChanged(this, m_Tag, newTag);
+        m_Tag = newTag;
+    }
     // ^O擾
-    const std::string& GetTag() const { return m_Tag; }
+    const std::string& GetTag() const { return m_Tag.GetString(); }
+    StringId GetTagId() const { return m_Tag; }
+    // ^Ov邩 (r)
+    bool CompareTag(StringId tag) const { return m_Tag == tag; }
+
+    // ===================================================================
+    // nh
+    // ===================================================================
+    // V[o^ɔsꂽnh擾 (o^Ȃ疳ȃnh)
+    GameObjectHandle GetHandle() const { return m_Handle; }
+
+    // ===================================================================
+    // Prefab
+    // ===================================================================
+    // Prefabԍݒ (SceneBase::SpawnŎݒ)
+    void SetPrefabId(int id) { m_PrefabId = id; }
+    // Prefabԍ擾 (Prefab琶ĂȂ-1)
+    int GetPrefabId() const { return m_PrefabId; }
+    // Prefab̑ҋ@XgɓĂ邩
+    void SetInPool(bool inPool) { m_InPool = inPool; }
+    bool IsInPool() const { return m_InPool; }
+
+    // ===================================================================
+    // E{bNX
+    // ===================================================================
+    // bVR|[lǧ`܂Ƃ߂[JԂ̋E{bNX (`󂪖 false)
+    bool GetLocalBounds(Bounds& bounds) const
+    {
+        bool found = false;
+        for (auto& meshComponent : m_MeshComponents)
+        {
+            Bounds local;
+            if (!meshComponent->GetLocalBounds(local)) continue;
+
+            if (found) bounds.Encapsulate(local);
+            else bounds = local;
+            found = true;
+        }
+        return found;
+    }
+    // [hԂ̋E{bNX (`󂪖Έʒû݂̓_)
+    Bounds GetWorldBounds() const
+    {
+        Bounds local;
+        GetLocalBounds(local);
+        return local.Transformed(m_Transform.GetWorldMatrix());
+    }
+    // `󂪕ςƂԃCfbNXɒm点
+    void MarkBoundsDirty() { m_Transform.MarkBoundsDirty(); }
+
+    // ԃCfbNX̓o^ID (SceneBase ݒ肷)
+    void SetSpatialId(int id) { m_SpatialId = id; }
+    int GetSpatialId() const { return m_SpatialId; }
+
+    // ԈXV̈ʑ (SceneBase ݒ肷)
+    void SetUpdatePhase(int phase) { m_UpdatePhase = phase; }
+    int GetUpdatePhase() const { return m_UpdatePhase; }
+
+private:
+    // p̔zƃrbgXV
+    template<typename T>
+    void SetComponentSlot(Component* component)
+    {
+        m_ComponentSlots[ComponentTypeId<T>()] = component;
+        if (component) m_ComponentMask |= ComponentBit<T>();
+        else           m_ComponentMask &= ~ComponentBit<T>();
+    }
+
+    // R|[lg𐶐 (A[iΌ^Ƃ̃v[m)
+    template<typename T, typename... Args>
+    PoolPtr<T> CreateComponent(Args&&... args)
+    {
+        if (m_pArena)
+        {
+            return m_pArena->Create<T>(std::forward<Args>(args)...);
+        }
+        return PoolPtr<T>(new T(std::forward<Args>(args)...));
+    }
 };
\ No newline at end of file
@@ -0,0 +1,196 @@
+// ===================================================================
+// GameObjectRegistry.cpp
+// GameObject̃nhǗE^O/O̎
+// ===================================================================
+#include "GameObjectRegistry.h"
+#include "GameObject.h"
+
+// ===================================================================
+// o^
+// ===================================================================
+GameObjectHandle GameObjectRegistry::Register(GameObject* object)
+{
+	if (!object) return GameObjectHandle();
+
+	// ɓo^ς݂Ȃ炻̃nhԂ
+	if (object->m_pRegistry == this)
+	{
+		return object->m_Handle;
+	}
+	// ʂ̃V[ɓo^ĂO
+	if (object->m_pRegistry)
+	{
+		object->m_pRegistry->Unregister(object);
+	}
+
+	// 󂫃Xbgėp (Βǉ)
+	uint32_t index;
+	if (!m_FreeSlots.empty())
+	{
+		index = m_FreeSlots.back();
+		m_FreeSlots.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(m_Slots.size());
+		m_Slots.emplace_back();
+	}
+
+	Slot& slot = m_Slots[index];
+	slot.object = object;
+	slot.tagPos = AddToBucket(m_TagBuckets, object->m_Tag, object);
+	slot.namePos = AddToBucket(m_NameBuckets, object->m_Name, object);
+
+	GameObjectHandle handle{ index, slot.generation };
+	object->m_pRegistry = this;
+	object->m_Handle = handle;
+	return handle;
+}
+
+// ===================================================================
+// o^
+// ===================================================================
+void GameObjectRegistry::Unregister(GameObject* object)
+{
+	if (!object || object->m_pRegistry != this) return;
+
+	GameObjectHandle handle = object->m_Handle;
+	Slot& slot = m_Slots[handle.index];
+
+	RemoveFromBucket(m_TagBuckets, object->m_Tag, slot.tagPos, true);
+	RemoveFromBucket(m_NameBuckets, object->m_Name, slot.namePos, false);
+
+	// i߂ČÂnh𖳌ɂ (0͖lȂ̂Ŕ΂)
+	slot.object = nullptr;
+	if (++slot.generation == 0) slot.generation = 1;
+	m_FreeSlots.push_back(handle.index);
+
+	object->m_pRegistry = nullptr;
+	object->m_Handle = GameObjectHandle();
+}
+
+// ===================================================================
+// Sĉ
+// ===================================================================
+void GameObjectRegistry::Clear()
+{
+	for (Slot& slot : m_Slots)
+	{
+		if (slot.object)
+		{
+			slot.object->m_pRegistry = nullptr;
+			slot.object->m_Handle = GameObjectHandle();
+		}
+	}
+
+	// Xbg͐ԍcߏɑSċ󂫂ɂ
+	m_FreeSlots.clear();
+	for (uint32_t i = 0; i < m_Slots.size(); i++)
+	{
+		Slot& slot = m_Slots[i];
+		if (slot.object)
+		{
+			slot.object = nullptr;
+			if (++slot.generation == 0) slot.generation = 1;
+		}
+		m_FreeSlots.push_back(i);
+	}
+
+	for (auto& bucket : m_TagBuckets) bucket.clear();
+	for (auto& bucket : m_NameBuckets) bucket.clear();
+}
+
+// ===================================================================
+// nhIuWFNg擾
+// ===================================================================
+GameObject* GameObjectRegistry::Resolve(GameObjectHandle handle) const
+{
+	if (handle.index >= m_Slots.size()) return nullptr;
+
+	const Slot& slot = m_Slots[handle.index];
+	return slot.generation == handle.generation ? slot.object : nullptr;
+}
+
+// ===================================================================
+// ^OEOŌ
+// ===================================================================
+std::span<GameObject* const> GameObjectRegistry::FindWithTag(const std::string& tag) const
+{
+	// xgĂȂȂYȂ (\͑₳Ȃ)
+	return FindWithTag(StringId::Find(tag));
+}
+
+std::span<GameObject* const> GameObjectRegistry::FindWithTag(StringId tag) const
+{
+	return GetBucket(m_TagBuckets, tag);
+}
+
+std::span<GameObject* const> GameObjectRegistry::FindWithName(const std::string& name) const
+{
+	return FindWithName(StringId::Find(name));
+}
+
+std::span<GameObject* const> GameObjectRegistry::FindWithName(StringId name) const
+{
+	return GetBucket(m_NameBuckets, name);
+}
+
+// ===================================================================
+// ^OEO̕ύXʒm
+// ===================================================================
+void GameObjectRegistry::OnTagChanged(GameObject* object, StringId oldTag, StringId newTag)
+{
+	Slot& slot = m_Slots[object->m_Handle.index];
+	RemoveFromBucket(m_TagBuckets, oldTag, slot.tagPos, true);
+	slot.tagPos = AddToBucket(m_TagBuckets, newTag, object);
+}
+
+void GameObjectRegistry::OnNameChanged(GameObject* object, StringId oldName, StringId newName)
+{
+	Slot& slot = m_Slots[object->m_Handle.index];
+	RemoveFromBucket(m_NameBuckets, oldName, slot.namePos, false);
+	slot.namePos = AddToBucket(m_NameBuckets, newName, object);
+}
+
+// ===================================================================
+// 
+// ===================================================================
+uint32_t GameObjectRegistry::AddToBucket(std::vector<std::vector<GameObject*>>& buckets, StringId key, GameObject* object)
+{
+	if (key.GetValue() >= buckets.size())
+	{
+		buckets.resize(key.GetValue() + 1);
+	}
+
+	auto& bucket = buckets[key.GetValue()];
+	bucket.push_back(object);
+	return static_cast<uint32_t>(bucket.size() - 1);
+}
+
+void GameObjectRegistry::RemoveFromBucket(std::vector<std::vector<GameObject*>>& buckets, StringId key, uint32_t pos, bool isTag)
+{
+	auto& bucket = buckets[key.GetValue()];
+
+	// ̗vf폜ʒuɈڂAڂvf̈ʒuXV
+	GameObject* moved = bucket.back();
+	bucket[pos] = moved;
+	bucket.pop_back();
+
+	if (pos < bucket.size())
+	{
+		Slot& movedSlot = m_Slots[moved->m_Handle.index];
+		if (isTag) movedSlot.tagPos = pos;
+		else       movedSlot.namePos = pos;
+	}
+}
+
+std::span<GameObject* const> GameObjectRegistry::GetBucket(const std::vector<std::vector<GameObject*>>& buckets, StringId key)
+{
+	if (!key.IsValid() || key.GetValue() >= buckets.size())
+	{
+		return {};
+	}
+
+	const auto& bucket = buckets[key.GetValue()];
+	return std::span<GameObject* const>(bucket.data(), bucket.size());
+}
\ No newline at end of file
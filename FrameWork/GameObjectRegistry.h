@@ -0,0 +1,103 @@
+// ===================================================================
+// GameObjectRegistry.h
+// V[GameObjectnhŊǗA^OEO̍ێ
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "StringId.h"
+
+class GameObject;
+
+// ===================================================================
+// GameObjectnh
+// 폜ꂽIuWFNg̃nh͐ԍȂȂ薳ɂȂ
+// ===================================================================
+struct GameObjectHandle
+{
+	uint32_t index = UINT32_MAX;	// Xbgԍ
+	uint32_t generation = 0;		// ԍ (0͖)
+
+	bool IsValid() const { return generation != 0; }
+
+	bool operator==(const GameObjectHandle& other) const
+	{
+		return index == other.index && generation == other.generation;
+	}
+	bool operator!=(const GameObjectHandle& other) const { return !(*this == other); }
+};
+
+// ===================================================================
+// GameObjectRegistry NX
+// o^E폜E^OύXɍXV̂ŁAO(1)
+// ===================================================================
+class GameObjectRegistry
+{
+private:
+	// ===================================================================
+	// Xbg
+	// ===================================================================
+	struct Slot
+	{
+		GameObject* object = nullptr;	// o^̃IuWFNg (󂫂Ȃnullptr)
+		uint32_t generation = 1;		// ėp邽тɑ
+		uint32_t tagPos = 0;			// ^Oł̈ʒu
+		uint32_t namePos = 0;			// Oł̈ʒu
+	};
+
+	std::vector<Slot> m_Slots;					// nh  IuWFNg
+	std::vector<uint32_t> m_FreeSlots;			// 󂫃Xbg
+
+	//  (StringId̒lŒڈ)
+	std::vector<std::vector<GameObject*>> m_TagBuckets;
+	std::vector<std::vector<GameObject*>> m_NameBuckets;
+
+public:
+	GameObjectRegistry() = default;
+	~GameObjectRegistry() { Clear(); }
+
+	GameObjectRegistry(const GameObjectRegistry&) = delete;
+	GameObjectRegistry& operator=(const GameObjectRegistry&) = delete;
+
+	// ===================================================================
+	// o^E폜
+	// ===================================================================
+
+	// o^ănh𔭍s
+	GameObjectHandle Register(GameObject* object);
+	// o^ (nh͈Ȍ㖳)
+	void Unregister(GameObject* object);
+	// Sĉ
+	void Clear();
+
+	// ===================================================================
+	// 
+	// ===================================================================
+
+	// nhIuWFNg擾 (폜ς݂Ȃnullptr)
+	GameObject* Resolve(GameObjectHandle handle) const;
+
+	// ^OvIuWFNgꗗ (mۂ𔺂ȂQƁBo^E폜ŖɂȂ)
+	std::span<GameObject* const> FindWithTag(const std::string& tag) const;
+	std::span<GameObject* const> FindWithTag(StringId tag) const;
+
+	// OvIuWFNgꗗ
+	std::span<GameObject* const> FindWithName(const std::string& name) const;
+	std::span<GameObject* const> FindWithName(StringId name) const;
+
+	// ===================================================================
+	// GameObjectĂ΂ (^OEO̕ύXʒm)
+	// ===================================================================
+	void OnTagChanged(GameObject* object, StringId oldTag, StringId newTag);
+	void OnNameChanged(GameObject* object, StringId oldName, StringId newName);
+
+private:
+	// ւ̒ǉE폜 (폜͖Ɠւċl߂)
+	static uint32_t AddToBucket(std::vector<std::vector<GameObject*>>& buckets, StringId key, GameObject* object);
+	void RemoveFromBucket(std::vector<std::vector<GameObject*>>& buckets, StringId key, uint32_t pos, bool isTag);
+
+	static std::span<GameObject* const> GetBucket(const std::vector<std::vector<GameObject*>>& buckets, StringId key);
+};
\ No newline at end of file
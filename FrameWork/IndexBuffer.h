@@ -1,5 +1,8 @@
 #pragma once
 
+#include	<algorithm>
+#include	<cstdint>
+#include	<span>
 #include	<vector>
 #include	<wrl/client.h>
 #include	"renderer.h"
@@ -8,28 +11,53 @@ using Microsoft::WRL::ComPtr;
 
 //-----------------------------------------------------------------------------
 //IndexBufferNX
+// CfbNXS 65535 ȉi_ 65536 jȂ16rbgō
+//  _x[XiDrawIndexed  BaseVertexLocationj̑ΒlŔ肷̂ŁA
+//    TuZbgƂ 65536 _ȂŜ̒_Ă16rbgɂȂ
 //-----------------------------------------------------------------------------
 class IndexBuffer {
 
 	ComPtr<ID3D11Buffer> m_IndexBuffer;
+	DXGI_FORMAT m_Format = DXGI_FORMAT_R32_UINT;	// CfbNX̌`
 
 public:
-	void Create(const std::vector<unsigned int>& indices)
+	// indices  vector łAϊς݃t@C (MeshFile) ̃}bv̈ł悢
+	void Create(std::span<const unsigned int> indices)
 	{
 		// foCX擾
 		ID3D11Device* device = nullptr;
 		device = Renderer::GetDevice();
 		assert(device); //device݂邱ƂmF
 
+		// 16rbgɎ܂΋lߒ
+		std::vector<uint16_t> indices16;
+		unsigned int maxindex = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end());
+		if (maxindex <= 0xFFFF)
+		{
+			indices16.assign(indices.begin(), indices.end());
+			m_Format = DXGI_FORMAT_R16_UINT;
+		}
+		else
+		{
+			m_Format = DXGI_FORMAT_R32_UINT;
+		}
+
 		// CfbNXobt@쐬
 		bool sts = Renderer::CreateIndexBuffer(
 			(unsigned int)(indices.size()),				// CfbNX
-			(void*)indices.data(),						// CfbNXf[^擪AhX
-			&m_IndexBuffer);							// CfbNXobt@
+			m_Format == DXGI_FORMAT_R16_UINT ? (void*)indices16.data() : (void*)indices.data(),	// CfbNXf[^擪AhX
+			&m_IndexBuffer,								// CfbNXobt@
+			GetIndexSize());							// CfbNX1oCg
 
 		assert(sts == true); //ʂmF
 	}
 
+	// CfbNX1oCg
+	unsigned int GetIndexSize() const
+	{
+		return m_Format == DXGI_FORMAT_R16_UINT ? sizeof(uint16_t) : sizeof(uint32_t);
+	}
+
 	void SetGPU()
 	{
 		// foCXReLXg擾
@@ -37,6 +65,6 @@ public:
 		devicecontext = Renderer::GetDeviceContext();
 
 		// CfbNXobt@Zbg
-		devicecontext->IASetIndexBuffer(m_IndexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+		devicecontext->IASetIndexBuffer(m_IndexBuffer.Get(), m_Format, 0);
 	}
 };
@@ -0,0 +1,290 @@
+// ===================================================================
+// LooseOctree.cpp
+// [Y؂̎
+// ===================================================================
+#include "LooseOctree.h"
+#include "GameObject.h"
+
+// ===================================================================
+// RXgN^
+// ===================================================================
+LooseOctree::LooseOctree(const Vector3& center, float halfSize, int maxDepth)
+{
+	Reset(center, halfSize, maxDepth);
+}
+
+// ===================================================================
+// [g̃Zݒ肵
+// ===================================================================
+void LooseOctree::Reset(const Vector3& center, float halfSize, int maxDepth)
+{
+	m_MaxDepth = maxDepth;
+	m_Nodes.clear();
+	m_Entries.clear();
+	m_FreeEntries.clear();
+	m_Count = 0;
+
+	Node root;
+	root.center = center;
+	root.halfSize = halfSize;
+	m_Nodes.push_back(root);
+}
+
+// ===================================================================
+// SĂ̗vf폜
+// ===================================================================
+void LooseOctree::Clear()
+{
+	Node root = m_Nodes[0];
+	Reset(root.center, root.halfSize, m_MaxDepth);
+}
+
+// ===================================================================
+// o^
+// ===================================================================
+int LooseOctree::Insert(GameObject* object, const Bounds& bounds)
+{
+	int id;
+	if (!m_FreeEntries.empty())
+	{
+		id = m_FreeEntries.back();
+		m_FreeEntries.pop_back();
+	}
+	else
+	{
+		id = static_cast<int>(m_Entries.size());
+		m_Entries.emplace_back();
+	}
+
+	Entry& entry = m_Entries[id];
+	entry.object = object;
+	entry.bounds = bounds;
+	Link(id, FindNode(bounds));
+
+	m_Count++;
+	return id;
+}
+
+// ===================================================================
+// E{bNXXV
+// ===================================================================
+void LooseOctree::Update(int id, const Bounds& bounds)
+{
+	if (id < 0 || id >= static_cast<int>(m_Entries.size()) || !m_Entries[id].object) return;
+
+	int node = FindNode(bounds);
+	m_Entries[id].bounds = bounds;
+
+	// m[hɎ܂Ȃ狫E{bNX̏ōς
+	if (node == m_Entries[id].node) return;
+
+	Unlink(id);
+	Link(id, node);
+}
+
+// ===================================================================
+// 폜
+// ===================================================================
+void LooseOctree::Remove(int id)
+{
+	if (id < 0 || id >= static_cast<int>(m_Entries.size()) || !m_Entries[id].object) return;
+
+	Unlink(id);
+	m_Entries[id] = Entry();
+	m_FreeEntries.push_back(id);
+	m_Count--;
+}
+
+// ===================================================================
+// 
+// ===================================================================
+void LooseOctree::QueryFrustum(const Frustum& frustum, std::vector<GameObject*>& out) const
+{
+	Query(0,
+		[&frustum](const Bounds& b)
+		{
+			if (!frustum.Intersects(b)) return Overlap::Outside;
+			return frustum.Contains(b) ? Overlap::Inside : Overlap::Partial;
+		},
+		[&frustum](const Bounds& b) { return frustum.Intersects(b); },
+		out);
+}
+
+void LooseOctree::QuerySphere(const Vector3& center, float radius, std::vector<GameObject*>& out) const
+{
+	Query(0,
+		[&center, radius](const Bounds& b)
+		{
+			return b.IntersectsSphere(center, radius) ? Overlap::Partial : Overlap::Outside;
+		},
+		[&center, radius](const Bounds& b) { return b.IntersectsSphere(center, radius); },
+		out);
+}
+
+void LooseOctree::QueryBox(const Bounds& box, std::vector<GameObject*>& out) const
+{
+	Query(0,
+		[&box](const Bounds& b)
+		{
+			if (!box.Intersects(b)) return Overlap::Outside;
+			return box.Contains(b.min) && box.Contains(b.max) ? Overlap::Inside : Overlap::Partial;
+		},
+		[&box](const Bounds& b) { return box.Intersects(b); },
+		out);
+}
+
+// ===================================================================
+// E{bNXm[hT
+// ===================================================================
+int LooseOctree::FindNode(const Bounds& bounds)
+{
+	Vector3 c = bounds.GetCenter();
+	Vector3 e = bounds.GetExtents();
+	float size = (std::max)((std::max)(e.x, e.y), e.z);
+
+	// S[g̃ZOĂvf̓[gɓ
+	const Node& root = m_Nodes[0];
+	if (std::fabs(c.x - root.center.x) > root.halfSize ||
+		std::fabs(c.y - root.center.y) > root.halfSize ||
+		std::fabs(c.z - root.center.z) > root.halfSize)
+	{
+		return 0;
+	}
+
+	int index = 0;
+	while (m_Nodes[index].depth < m_MaxDepth)
+	{
+		// qm[h̎󂯓͈ (Z2{) Ɏ܂Ȃ΂ɓ
+		float childHalf = m_Nodes[index].halfSize * 0.5f;
+		if (size > childHalf) break;
+
+		// SZI
+		const Vector3& nc = m_Nodes[index].center;
+		int octant = (c.x >= nc.x ? 1 : 0) | (c.y >= nc.y ? 2 : 0) | (c.z >= nc.z ? 4 : 0);
+
+		if (m_Nodes[index].children[octant] < 0)
+		{
+			Node child;
+			child.center = Vector3(
+				nc.x + ((octant & 1) ? childHalf : -childHalf),
+				nc.y + ((octant & 2) ? childHalf : -childHalf),
+				nc.z + ((octant & 4) ? childHalf : -childHalf));
+			child.halfSize = childHalf;
+			child.depth = m_Nodes[index].depth + 1;
+			child.parent = index;
+
+			// push_back ŎQƂɂȂ̂Ŕԍň
+			int childIndex = static_cast<int>(m_Nodes.size());
+			m_Nodes.push_back(child);
+			m_Nodes[index].children[octant] = childIndex;
+		}
+		index = m_Nodes[index].children[octant];
+	}
+	return index;
+}
+
+// ===================================================================
+// m[h̎󂯓͈
+// ===================================================================
+Bounds LooseOctree::GetLooseBounds(const Node& node) const
+{
+	float loose = node.halfSize * 2.0f;
+	return Bounds::FromCenterExtents(node.center, Vector3(loose, loose, loose));
+}
+
+// ===================================================================
+// m[hւ̏o
+// ===================================================================
+void LooseOctree::Link(int id, int node)
+{
+	Entry& entry = m_Entries[id];
+	entry.node = node;
+	entry.slot = static_cast<int>(m_Nodes[node].entries.size());
+	m_Nodes[node].entries.push_back(id);
+
+	for (int n = node; n >= 0; n = m_Nodes[n].parent)
+	{
+		m_Nodes[n].subtreeCount++;
+	}
+}
+
+void LooseOctree::Unlink(int id)
+{
+	Entry& entry = m_Entries[id];
+	std::vector<int>& entries = m_Nodes[entry.node].entries;
+
+	// ̗vfƓւč폜
+	int last = entries.back();
+	entries[entry.slot] = last;
+	m_Entries[last].slot = entry.slot;
+	entries.pop_back();
+
+	for (int n = entry.node; n >= 0; n = m_Nodes[n].parent)
+	{
+		m_Nodes[n].subtreeCount--;
+	}
+
+	entry.node = -1;
+	entry.slot = -1;
+}
+
+// ===================================================================
+// ؂
+// ===================================================================
+template<typename NodeTest, typename EntryTest>
+void LooseOctree::Query(int index, const NodeTest& nodeTest, const EntryTest& entryTest, std::vector<GameObject*>& out) const
+{
+	const Node& node = m_Nodes[index];
+	if (node.subtreeCount == 0) return;
+
+	for (int id : node.entries)
+	{
+		const Entry& entry = m_Entries[id];
+		if (entry.object->IsActive() && entryTest(entry.bounds))
+		{
+			out.push_back(entry.object);
+		}
+	}
+
+	for (int child : node.children)
+	{
+		if (child < 0 || m_Nodes[child].subtreeCount == 0) continue;
+
+		switch (nodeTest(GetLooseBounds(m_Nodes[child])))
+		{
+		case Overlap::Outside:
+			break;
+		case Overlap::Inside:
+			CollectAll(child, out);
+			break;
+		case Overlap::Partial:
+			Query(child, nodeTest, entryTest, out);
+			break;
+		}
+	}
+}
+
+// ===================================================================
+// ؂̗vf𔻒肹ɑSĒǉ
+// ===================================================================
+void LooseOctree::CollectAll(int index, std::vector<GameObject*>& out) const
+{
+	const Node& node = m_Nodes[index];
+	if (node.subtreeCount == 0) return;
+
+	for (int id : node.entries)
+	{
+		const Entry& entry = m_Entries[id];
+		if (entry.object->IsActive())
+		{
+			out.push_back(entry.object);
+		}
+	}
+	for (int child : node.children)
+	{
+		if (child >= 0)
+		{
+			CollectAll(child, out);
+		}
+	}
+}
\ No newline at end of file
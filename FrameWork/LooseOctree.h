@@ -0,0 +1,102 @@
+// ===================================================================
+// LooseOctree.h
+// GameObject̋E{bNXo^ԃCfbNX ([Y)
+// em[h͎g̃Z2{͈̔͂܂ŗvf󂯓̂ŁA
+// vf́u傫vƁuSZvŒuꏊ܂AE܂ł̊KwɏオȂ
+// EE{bNXɂ錟`EAIETEhŋʂɎg
+// ===================================================================
+#pragma once
+#include <vector>
+
+#include "Bounds.h"
+
+class GameObject;
+
+class LooseOctree
+{
+private:
+	// ===================================================================
+	// m[h
+	// ===================================================================
+	struct Node
+	{
+		Vector3 center;				// Z̒S
+		float halfSize = 0.0f;		// Z̔̑傫 (󂯓͈͂͂2{)
+		int depth = 0;				// [ ([g0)
+		int parent = -1;			// em[h
+		int children[8];			// qm[h (-1Ȃ疢쐬)
+		int subtreeCount = 0;		// ̕؂ɓĂvf̐ (̕؂HȂ)
+		std::vector<int> entries;	// ̃m[hɓĂvf
+
+		Node() { std::fill(std::begin(children), std::end(children), -1); }
+	};
+
+	// ===================================================================
+	// vf
+	// ===================================================================
+	struct Entry
+	{
+		GameObject* object = nullptr;	// o^ĂGameObject (nullptrȂ)
+		Bounds bounds;					// [hԂ̋E{bNX
+		int node = -1;					// Ăm[h
+		int slot = -1;					// m[h entries ̈ʒu
+	};
+
+	std::vector<Node> m_Nodes;			// m[h (0Ԃ[g)
+	std::vector<Entry> m_Entries;		// vf (ԍ = o^ID)
+	std::vector<int> m_FreeEntries;		// 󂢂Ăvfԍ
+	int m_MaxDepth = 6;					// ő̐[
+	size_t m_Count = 0;					// o^
+
+	// ͈͂ƃm[h̏dȂ
+	enum class Overlap
+	{
+		Outside,	// dȂȂ (؂ƏO)
+		Partial,	// ꕔdȂ (vfƂɔ)
+		Inside,		// Ŝ܂܂ (؂ƒǉ)
+	};
+
+public:
+	// center, halfSize: [g̃Z (Oꂽvf̓[gɓ)
+	explicit LooseOctree(const Vector3& center = Vector3(0.0f, 0.0f, 0.0f), float halfSize = 512.0f, int maxDepth = 6);
+
+	// [g̃Zݒ肵 (o^ς݂̗vf͑Sč폜)
+	void Reset(const Vector3& center, float halfSize, int maxDepth = 6);
+	// SĂ̗vf폜
+	void Clear();
+
+	// ===================================================================
+	// o^EXVE폜
+	// ===================================================================
+	// o^ID擾
+	int Insert(GameObject* object, const Bounds& bounds);
+	// E{bNXXV (m[hɎ܂ꍇ͕tւȂ)
+	void Update(int id, const Bounds& bounds);
+	// 폜
+	void Remove(int id);
+
+	// o^
+	size_t GetCount() const { return m_Count; }
+
+	// ===================================================================
+	//  (ʂ out ̖ɒǉBANeBuGameObject͊܂܂Ȃ)
+	// ===================================================================
+	void QueryFrustum(const Frustum& frustum, std::vector<GameObject*>& out) const;
+	void QuerySphere(const Vector3& center, float radius, std::vector<GameObject*>& out) const;
+	void QueryBox(const Bounds& box, std::vector<GameObject*>& out) const;
+
+private:
+	// E{bNXm[hT (KvȂqm[h)
+	int FindNode(const Bounds& bounds);
+	// m[h̎󂯓͈
+	Bounds GetLooseBounds(const Node& node) const;
+	// m[hւ̏o
+	void Link(int id, int node);
+	void Unlink(int id);
+
+	// ؂ (nodeTest: m[h̎󂯓͈͂̔ / entryTest: vf̔)
+	template<typename NodeTest, typename EntryTest>
+	void Query(int node, const NodeTest& nodeTest, const EntryTest& entryTest, std::vector<GameObject*>& out) const;
+	// ؂̗vf𔻒肹ɑSĒǉ
+	void CollectAll(int node, std::vector<GameObject*>& out) const;
+};
\ No newline at end of file
@@ -0,0 +1,36 @@
+// ===================================================================
+// MappedFile.h
+// ǂݍݐp̃}bvgt@C
+// t@C̒gRs[ɂ̂܂܃|C^ŎQƂ
+// ===================================================================
+#pragma once
+#include <cstddef>
+#include <string>
+#include <utility>
+
+class MappedFile
+{
+private:
+	void* m_File = nullptr;					// t@Cnh
+	void* m_Mapping = nullptr;				// }bsOIuWFNg
+	const std::byte* m_Data = nullptr;		// }bv擪
+	size_t m_Size = 0;						// t@CTCY
+
+public:
+	MappedFile() = default;
+	~MappedFile() { Close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	// t@CJă}bv (̃t@C͎s)
+	bool Open(const std::string& path);
+	// }bvĕ
+	void Close();
+
+	bool IsOpen() const { return m_Data != nullptr; }
+	const std::byte* GetData() const { return m_Data; }
+	size_t GetSize() const { return m_Size; }
+};
\ No newline at end of file
@@ -8,12 +8,12 @@ protected:
 	std::vector<unsigned int>	m_indices;		// CfbNXf[^Q
 public:
 	// _f[^擾
-	const std::vector<VERTEX_3D>& GetVertices() {
+	const std::vector<VERTEX_3D>& GetVertices() const {
 		return m_vertices;
 	}
 
 	// CfbNXf[^擾
-	const std::vector<unsigned int>& GetIndices() {
+	const std::vector<unsigned int>& GetIndices() const {
 		return m_indices;
 	}
 };
@@ -6,6 +6,7 @@
 #pragma once
 #include "SystemCommon.h"
 #include "Component.h"
+#include "Bounds.h"
 
 // ===================================================================
 // O錾
@@ -68,4 +69,11 @@ public:
     //virtual void SetColor(const DirectX::SimpleMath::Color& color) {}
 
     DirectX::SimpleMath::Color GetColor() { return m_Color; };
+
+    // ===================================================================
+    // E{bNX (hNXŃI[o[Ch)
+    // ===================================================================
+
+    // [JԂ̋E{bNX擾 (`Ȃ false)
+    virtual bool GetLocalBounds(Bounds& bounds) const { return false; }
 };
\ No newline at end of file
@@ -4,22 +4,7 @@
 #include "SimplePlaneRendererComponent.h"
 #include "MeshRendererComponent.h"
 
-template <typename T>
-struct TypeTag {};
-
-TypeTag<SimpleCubeRendererComponent>    tag_cube;
-TypeTag<SimplePlaneRendererComponent>   tag_plane;
-TypeTag<MeshRendererComponent>   tag_model;
-
-std::string strSimpleCube = "SimpleCube";
-std::string strSimplePlane = "SimplePlane";
-std::string strModel = "Model";
-
-std::unordered_map<std::string, void*> typeTags = {
-    { strSimpleCube, &tag_cube },
-    { strSimplePlane, &tag_plane },
-    { strModel,& tag_model },
-};
+// xml  ObjectType ƕ`R|[lg̑Ή StageObjectType (StageFile.h) Q
 
 // ^ɉ
 //template <typename T>
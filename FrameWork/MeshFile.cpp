@@ -0,0 +1,298 @@
+// ===================================================================
+// MeshFile.cpp
+// ϊς݃bṼoCi`̏oEǂݍ
+// ===================================================================
+#include "MeshFile.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	// t@C̑傫EXV擾 ( false)
+	bool GetSourceStamp(const std::string& source, uint64_t& size, int64_t& time)
+	{
+		namespace fs = std::filesystem;
+
+		std::error_code ec;
+		size = fs::file_size(source, ec);
+		if (ec) return false;
+		auto writeTime = fs::last_write_time(source, ec);
+		if (ec) return false;
+		time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+		return true;
+	}
+}
+
+// ===================================================================
+// ϊς݃t@CJ
+// ===================================================================
+std::unique_ptr<const MeshFile> MeshFile::Open(const std::string& source)
+{
+	uint64_t sourceSize = 0;
+	int64_t sourceTime = 0;
+	bool hasSource = GetSourceStamp(source, sourceSize, sourceTime);
+
+	auto file = std::make_unique<MeshFile>();
+	if (!file->Map(GetCookedPath(source), hasSource, sourceSize, sourceTime))
+	{
+		return nullptr;
+	}
+	return file;
+}
+
+// ===================================================================
+// ϊς݃t@Co
+// ===================================================================
+bool MeshFile::Cook(const std::string& source, const MeshCookData& data)
+{
+	MeshFileHeader header{};
+	header.magic = MeshFileHeader::Magic;
+	header.version = MeshFileHeader::Version;
+	if (!GetSourceStamp(source, header.sourceSize, header.sourceTime))
+	{
+		return false;
+	}
+
+	// \ (1ɂ܂Ƃ߂)
+	std::vector<MeshStringEntry> strings;
+	std::string stringData;
+	std::unordered_map<std::string, uint32_t> stringIndex;
+	auto addString = [&](const std::string& str) -> uint32_t
+	{
+		auto it = stringIndex.find(str);
+		if (it != stringIndex.end()) return it->second;
+
+		uint32_t index = static_cast<uint32_t>(strings.size());
+		strings.push_back({ static_cast<uint32_t>(stringData.size()), static_cast<uint32_t>(str.size()) });
+		stringData.append(str);
+		stringData.push_back('\0');
+		stringIndex.emplace(str, index);
+		return index;
+	};
+
+	// TuZbg (LOD0 ̌Ɋe LOD ׂ)
+	std::vector<MeshSubsetRecord> subsets;
+	subsets.reserve(data.subsets.size() * (1 + data.lods.size()));
+	auto addSubsets = [&](std::span<const SUBSET> lodSubsets)
+	{
+		for (const SUBSET& subset : lodSubsets)
+		{
+			subsets.push_back({ subset.IndexNum, subset.VertexNum, subset.IndexBase, subset.VertexBase,
+				subset.MaterialIdx, addString(subset.MtrlName) });
+		}
+	};
+	addSubsets(data.subsets);
+	for (const std::vector<SUBSET>& lod : data.lods)
+	{
+		if (lod.size() != data.subsets.size()) return false;
+		addSubsets(lod);
+	}
+
+	// eNX` (eNX`̓~bvEkς݂̃f[^)
+	std::vector<MeshTextureRecord> textures;
+	textures.reserve(data.materials.size());
+	uint32_t textureDataSize = 0;
+	for (size_t i = 0; i < data.materials.size(); i++)
+	{
+		MeshTextureRecord texture{};
+		texture.name = addString(i < data.textureNames.size() ? data.textureNames[i] : std::string());
+
+		const TextureCookData* embedded = i < data.embeddedTextures.size() ? data.embeddedTextures[i] : nullptr;
+		if (embedded && !embedded->mips.empty())
+		{
+			texture.width = embedded->width;
+			texture.height = embedded->height;
+			texture.format = embedded->dxgiFormat;
+			texture.mipCount = static_cast<uint32_t>(embedded->mips.size());
+			texture.dataOffset = textureDataSize;
+			for (size_t m = 0; m < embedded->mips.size(); m++)
+			{
+				// ~bv̑傫`ƍĂ邱 (ǂݍݎƓтɂ)
+				uint32_t width = std::max(1u, embedded->width >> m);
+				uint32_t height = std::max(1u, embedded->height >> m);
+				if (embedded->mips[m].size() != TextureFile::GetMipSize(embedded->dxgiFormat, width, height))
+				{
+					return false;
+				}
+				texture.dataSize += static_cast<uint32_t>(embedded->mips[m].size());
+			}
+			// ̃eNX`4oCgEn߂
+			textureDataSize += (texture.dataSize + 3) & ~3u;
+		}
+		textures.push_back(texture);
+	}
+
+	// zu߂ (ez4oCgEn߂)
+	auto align = [](size_t offset) { return static_cast<uint32_t>((offset + 3) & ~size_t(3)); };
+
+	header.vertexCount = static_cast<uint32_t>(data.vertices.size());
+	header.indexCount = static_cast<uint32_t>(data.indices.size());
+	header.subsetCount = static_cast<uint32_t>(data.subsets.size());
+	header.lodCount = static_cast<uint32_t>(1 + data.lods.size());
+	header.materialCount = static_cast<uint32_t>(data.materials.size());
+	header.stringCount = static_cast<uint32_t>(strings.size());
+	header.stringDataSize = static_cast<uint32_t>(stringData.size());
+	header.textureDataSize = textureDataSize;
+	header.vertexOffset = align(sizeof(MeshFileHeader));
+	header.indexOffset = align(header.vertexOffset + data.vertices.size() * sizeof(VERTEX_PACKED));
+	header.subsetOffset = align(header.indexOffset + data.indices.size() * sizeof(uint32_t));
+	header.materialOffset = align(header.subsetOffset + subsets.size() * sizeof(MeshSubsetRecord));
+	header.textureOffset = align(header.materialOffset + data.materials.size() * sizeof(MATERIAL));
+	header.stringTableOffset = align(header.textureOffset + textures.size() * sizeof(MeshTextureRecord));
+	header.stringDataOffset = align(header.stringTableOffset + strings.size() * sizeof(MeshStringEntry));
+	header.textureDataOffset = align(header.stringDataOffset + stringData.size());
+	header.fileSize = align(header.textureDataOffset + textureDataSize);
+
+	header.boundsMin[0] = data.bounds.min.x;
+	header.boundsMin[1] = data.bounds.min.y;
+	header.boundsMin[2] = data.bounds.min.z;
+	header.boundsMax[0] = data.bounds.max.x;
+	header.boundsMax[1] = data.bounds.max.y;
+	header.boundsMax[2] = data.bounds.max.z;
+
+	// ꎞt@CɏĂu (̃t@Cǂ܂Ȃ)
+	// bVʃXbhɕϊĂՓ˂Ȃ悤Aꎞt@C̓XbhƂɕς
+	std::string path = GetCookedPath(source);
+	std::string tempPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out) return false;
+
+		auto writeAt = [&out](uint32_t offset, const void* data, size_t size)
+		{
+			// E킹̌Ԃ0Ŗ߂
+			while (static_cast<size_t>(out.tellp()) < offset) out.put('\0');
+			out.write(static_cast<const char*>(data), size);
+		};
+		writeAt(0, &header, sizeof(header));
+		writeAt(header.vertexOffset, data.vertices.data(), data.vertices.size() * sizeof(VERTEX_PACKED));
+		writeAt(header.indexOffset, data.indices.data(), data.indices.size() * sizeof(uint32_t));
+		writeAt(header.subsetOffset, subsets.data(), subsets.size() * sizeof(MeshSubsetRecord));
+		writeAt(header.materialOffset, data.materials.data(), data.materials.size() * sizeof(MATERIAL));
+		writeAt(header.textureOffset, textures.data(), textures.size() * sizeof(MeshTextureRecord));
+		writeAt(header.stringTableOffset, strings.data(), strings.size() * sizeof(MeshStringEntry));
+		writeAt(header.stringDataOffset, stringData.data(), stringData.size());
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (textures[i].width == 0) continue;
+			uint32_t offset = header.textureDataOffset + textures[i].dataOffset;
+			for (const std::vector<uint8_t>& mip : data.embeddedTextures[i]->mips)
+			{
+				writeAt(offset, mip.data(), mip.size());
+				offset += static_cast<uint32_t>(mip.size());
+			}
+		}
+		writeAt(header.fileSize, nullptr, 0);
+
+		if (!out) return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+// ===================================================================
+// }bvĒg؂
+// ===================================================================
+bool MeshFile::Map(const std::string& path, bool hasSource, uint64_t sourceSize, int64_t sourceTime)
+{
+	if (!m_File.Open(path)) return false;
+
+	const std::byte* data = m_File.GetData();
+	size_t size = m_File.GetSize();
+
+	// ͈͓4oCgE
+	auto inRange = [size](uint32_t offset, size_t bytes)
+	{
+		return offset % 4 == 0 && offset <= size && bytes <= size - offset;
+	};
+
+	bool valid = size >= sizeof(MeshFileHeader);
+	const MeshFileHeader* header = reinterpret_cast<const MeshFileHeader*>(data);
+	valid = valid &&
+		header->magic == MeshFileHeader::Magic &&
+		header->version == MeshFileHeader::Version &&
+		header->fileSize == size &&
+		(!hasSource || (header->sourceSize == sourceSize && header->sourceTime == sourceTime)) &&
+		inRange(header->vertexOffset, size_t(header->vertexCount) * sizeof(VERTEX_PACKED)) &&
+		inRange(header->indexOffset, size_t(header->indexCount) * sizeof(uint32_t)) &&
+		header->lodCount >= 1 &&
+		inRange(header->subsetOffset, size_t(header->subsetCount) * header->lodCount * sizeof(MeshSubsetRecord)) &&
+		inRange(header->materialOffset, size_t(header->materialCount) * sizeof(MATERIAL)) &&
+		inRange(header->textureOffset, size_t(header->materialCount) * sizeof(MeshTextureRecord)) &&
+		inRange(header->stringTableOffset, size_t(header->stringCount) * sizeof(MeshStringEntry)) &&
+		inRange(header->stringDataOffset, header->stringDataSize) &&
+		inRange(header->textureDataOffset, header->textureDataSize);
+
+	if (valid)
+	{
+		m_Header = header;
+		m_Vertices = reinterpret_cast<const VERTEX_PACKED*>(data + header->vertexOffset);
+		m_Indices = reinterpret_cast<const uint32_t*>(data + header->indexOffset);
+		m_Subsets = reinterpret_cast<const MeshSubsetRecord*>(data + header->subsetOffset);
+		m_Materials = reinterpret_cast<const MATERIAL*>(data + header->materialOffset);
+		m_Textures = reinterpret_cast<const MeshTextureRecord*>(data + header->textureOffset);
+		m_Strings = reinterpret_cast<const MeshStringEntry*>(data + header->stringTableOffset);
+		m_StringData = reinterpret_cast<const char*>(data + header->stringDataOffset);
+		m_TextureData = reinterpret_cast<const uint8_t*>(data + header->textureDataOffset);
+
+		// ETuZbgEeNX`͈̔͂mF (ȍ~̎QƂł͊mFȂ)
+		for (uint32_t i = 0; valid && i < header->stringCount; i++)
+		{
+			valid = size_t(m_Strings[i].offset) + m_Strings[i].length < header->stringDataSize;
+		}
+		for (size_t i = 0; valid && i < size_t(header->subsetCount) * header->lodCount; i++)
+		{
+			const MeshSubsetRecord& s = m_Subsets[i];
+			valid = s.mtrlName < header->stringCount &&
+				s.indexBase <= header->indexCount && s.indexNum <= header->indexCount - s.indexBase &&
+				s.vertexBase <= header->vertexCount && s.vertexNum <= header->vertexCount - s.vertexBase;
+		}
+		for (uint32_t i = 0; valid && i < header->materialCount; i++)
+		{
+			const MeshTextureRecord& t = m_Textures[i];
+			std::vector<TextureMip> mips;
+			valid = t.name < header->stringCount &&
+				(t.width == 0 || (
+					t.dataOffset % 4 == 0 &&
+					t.dataOffset <= header->textureDataSize && t.dataSize <= header->textureDataSize - t.dataOffset &&
+					TextureFile::LayoutMips(static_cast<DXGI_FORMAT>(t.format), t.width, t.height, t.mipCount,
+						m_TextureData + t.dataOffset, t.dataSize, mips)));
+		}
+	}
+
+	if (!valid)
+	{
+		m_File.Close();
+		m_Header = nullptr;
+		return false;
+	}
+	return true;
+}
+
+// ===================================================================
+// eNX`̃~bv
+// ===================================================================
+std::vector<TextureMip> MeshFile::GetTextureMips(const MeshTextureRecord& texture) const
+{
+	std::vector<TextureMip> mips;
+	if (texture.width > 0)
+	{
+		// ͈́E傫 Map ŊmFς
+		TextureFile::LayoutMips(static_cast<DXGI_FORMAT>(texture.format), texture.width, texture.height, texture.mipCount,
+			m_TextureData + texture.dataOffset, texture.dataSize, mips);
+	}
+	return mips;
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+// ===================================================================
+// MeshFile.h
+// ϊς݃bṼoCi` (t@C + ".mesh")
+// StaticMesh ɓǂݍ񂾌̒_ECfbNXETuZbgE}eÂ܂܏o
+// t@C (obj / fbx Ȃ) ̑傫EXVL^AςĂ΍蒼
+// t@CΕϊς݃t@Ĉ܂܎g (Assimp ʂɓǂ߂)
+// ǂݍ݂̓}bvāAẑ܂܎QƂ
+//
+// t@C\ (S4oCgE)
+//   MeshFileHeader
+//   VERTEX_PACKED[vertexCount]			_ (kς݁Bbounds ŕ)
+//   uint32_t[indexCount]				CfbNX
+//   MeshSubsetRecord[subsetCount * lodCount]	TuZbg (LOD0 珇ɁBLOD ̓CfbNXႤ)
+//   MATERIAL[materialCount]			}eA
+//   MeshTextureRecord[materialCount]	}eAƂ̃eNX`
+//   MeshStringEntry[stringCount]		\
+//   char[stringDataSize]				{ (e '\0' I[)
+//   uint8_t[textureDataSize]			eNX` (~bvEubNkς݁B~bv̕т TextureFile Ɠ)
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.h"
+#include "Bounds.h"
+#include "renderer.h"
+#include "TextureFile.h"
+
+// ===================================================================
+// t@C̍\
+// ===================================================================
+struct MeshFileHeader
+{
+	static constexpr uint32_t Magic = 0x4248534D;	// "MSHB"
+	static constexpr uint32_t Version = 5;			// `Eǂݍݕ@ςグ (Ât@C͍蒼)
+
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceSize;		// ϊt@C̑傫
+	int64_t sourceTime;			// ϊt@C̍XV
+	uint32_t vertexCount;
+	uint32_t indexCount;
+	uint32_t subsetCount;		// LOD 1̃TuZbg
+	uint32_t lodCount;			// LOD ̐ (1 ȏ)
+	uint32_t materialCount;
+	uint32_t stringCount;
+	uint32_t stringDataSize;
+	uint32_t textureDataSize;
+	uint32_t vertexOffset;
+	uint32_t indexOffset;
+	uint32_t subsetOffset;
+	uint32_t materialOffset;
+	uint32_t textureOffset;
+	uint32_t stringTableOffset;
+	uint32_t stringDataOffset;
+	uint32_t textureDataOffset;
+	float boundsMin[3];			// E{bNX (_̈ʒükɂg)
+	float boundsMax[3];
+	uint32_t fileSize;
+};
+
+struct MeshSubsetRecord
+{
+	uint32_t indexNum;
+	uint32_t vertexNum;
+	uint32_t indexBase;
+	uint32_t vertexBase;
+	uint32_t materialIdx;
+	uint32_t mtrlName;		// \̔ԍ
+};
+
+struct MeshTextureRecord
+{
+	uint32_t name;			// \̔ԍ (eNX`͋󕶎)
+	uint32_t width;			// eNX`̑傫 (Ot@C 0)
+	uint32_t height;
+	uint32_t format;		// DXGI_FORMAT (BC1 / BC3 / BC7 / R8G8B8A8)
+	uint32_t mipCount;
+	uint32_t dataOffset;	// eNX`̐擪̈ʒu
+	uint32_t dataSize;		// S~bṽoCg
+};
+
+struct MeshStringEntry
+{
+	uint32_t offset;	// {̂̐擪̈ʒu
+	uint32_t length;	//  ('\0' ܂܂Ȃ)
+};
+
+// oe (z̓}eA)
+struct MeshCookData
+{
+	std::span<const VERTEX_PACKED> vertices;
+	std::span<const unsigned int> indices;
+	std::span<const SUBSET> subsets;
+	std::span<const std::vector<SUBSET>> lods;			// LOD1 ȍ~̃TuZbg (subsets ƓE)
+	std::span<const MATERIAL> materials;
+	std::span<const std::string> textureNames;
+	std::span<const TextureCookData* const> embeddedTextures;	// eNX` (~bvEkς݁BOt@C nullptr)
+	Bounds bounds;
+};
+
+// ===================================================================
+// MeshFile
+// ===================================================================
+class MeshFile
+{
+private:
+	MappedFile m_File;
+	const MeshFileHeader* m_Header = nullptr;
+	const VERTEX_PACKED* m_Vertices = nullptr;
+	const uint32_t* m_Indices = nullptr;
+	const MeshSubsetRecord* m_Subsets = nullptr;
+	const MATERIAL* m_Materials = nullptr;
+	const MeshTextureRecord* m_Textures = nullptr;
+	const MeshStringEntry* m_Strings = nullptr;
+	const char* m_StringData = nullptr;
+	const uint8_t* m_TextureData = nullptr;
+
+public:
+	// ===================================================================
+	// ǂݍ݁Eo ([J[XbhĂł悢)
+	// ===================================================================
+
+	// ϊς݃t@CJ (Et@CÂE`Ⴄꍇ nullptr)
+	static std::unique_ptr<const MeshFile> Open(const std::string& source);
+	// ϊς݃t@Co
+	static bool Cook(const std::string& source, const MeshCookData& data);
+
+	// pX
+	static std::string GetCookedPath(const std::string& source) { return source + ".mesh"; }
+
+	// ===================================================================
+	// Q (Ԃl͂ MeshFile ĂԂ̂ݗL)
+	// ===================================================================
+	std::span<const VERTEX_PACKED> GetVertices() const { return { m_Vertices, m_Header->vertexCount }; }
+	std::span<const uint32_t> GetIndices() const { return { m_Indices, m_Header->indexCount }; }
+	size_t GetLodCount() const { return m_Header->lodCount; }
+	std::span<const MeshSubsetRecord> GetSubsets(size_t lod = 0) const
+	{
+		return { m_Subsets + lod * m_Header->subsetCount, m_Header->subsetCount };
+	}
+	std::span<const MATERIAL> GetMaterials() const { return { m_Materials, m_Header->materialCount }; }
+	std::span<const MeshTextureRecord> GetTextures() const { return { m_Textures, m_Header->materialCount }; }
+
+	Bounds GetBounds() const
+	{
+		return Bounds(
+			Vector3(m_Header->boundsMin[0], m_Header->boundsMin[1], m_Header->boundsMin[2]),
+			Vector3(m_Header->boundsMax[0], m_Header->boundsMax[1], m_Header->boundsMax[2]));
+	}
+
+	// eNX`̃~bv (Texture::SetMips ɂ̂܂ܓnBOt@C͋)
+	std::vector<TextureMip> GetTextureMips(const MeshTextureRecord& texture) const;
+
+	std::string_view GetString(uint32_t index) const
+	{
+		const MeshStringEntry& entry = m_Strings[index];
+		return std::string_view(m_StringData + entry.offset, entry.length);
+	}
+
+private:
+	// }bvĒg؂ (source* ͌t@C̏Bt@CΊmFȂ)
+	bool Map(const std::string& path, bool hasSource, uint64_t sourceSize, int64_t sourceTime);
+};
\ No newline at end of file
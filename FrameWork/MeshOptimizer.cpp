@@ -0,0 +1,458 @@
+// ===================================================================
+// MeshOptimizer.cpp
+// bV̒_ECfbNX̍œK
+// ===================================================================
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace MeshOptimizer
+{
+	namespace
+	{
+		// ===================================================================
+		// LbV̖͋[ (FIFO)
+		// _ƂɓoĂAȍ~̒ǉ cacheSize ȂLbVɂ
+		// ===================================================================
+		class FifoCache
+		{
+		private:
+			std::vector<unsigned int> m_Stamps;
+			unsigned int m_Time;
+			unsigned int m_Size;
+
+		public:
+			FifoCache(size_t vertexCount, unsigned int size)
+				: m_Stamps(vertexCount, 0), m_Time(size + 1), m_Size(size) {}
+
+			// QƂ (~XȂ true)
+			bool Access(unsigned int v)
+			{
+				if (m_Time - m_Stamps[v] <= m_Size) return false;
+				m_Stamps[v] = m_Time++;
+				return true;
+			}
+		};
+
+		// 1TuZbg̃LbV~X
+		size_t CountCacheMisses(const unsigned int* indices, size_t indexCount, size_t vertexCount, unsigned int cacheSize)
+		{
+			FifoCache cache(vertexCount, cacheSize);
+			size_t misses = 0;
+			for (size_t i = 0; i < indexCount; i++)
+			{
+				misses += cache.Access(indices[i]) ? 1 : 0;
+			}
+			return misses;
+		}
+
+		// ===================================================================
+		// n (S_ŏɌꂽ̂ɕtւB̂Ă̂͒_tFb`œKōs)
+		// ===================================================================
+		struct VertexHash
+		{
+			size_t operator()(const VERTEX_3D* v) const
+			{
+				// FNV-1a
+				const unsigned char* bytes = reinterpret_cast<const unsigned char*>(v);
+				size_t hash = 14695981039346656037ull;
+				for (size_t i = 0; i < sizeof(VERTEX_3D); i++)
+				{
+					hash = (hash ^ bytes[i]) * 1099511628211ull;
+				}
+				return hash;
+			}
+		};
+		struct VertexEqual
+		{
+			bool operator()(const VERTEX_3D* a, const VERTEX_3D* b) const
+			{
+				return std::memcmp(a, b, sizeof(VERTEX_3D)) == 0;
+			}
+		};
+
+		void WeldVertices(unsigned int* indices, size_t indexCount, const VERTEX_3D* vertices, size_t vertexCount)
+		{
+			std::vector<unsigned int> remap(vertexCount);
+			std::unordered_map<const VERTEX_3D*, unsigned int, VertexHash, VertexEqual> unique;
+			unique.reserve(vertexCount);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				remap[v] = unique.try_emplace(&vertices[v], static_cast<unsigned int>(v)).first->second;
+			}
+			for (size_t i = 0; i < indexCount; i++)
+			{
+				indices[i] = remap[indices[i]];
+			}
+		}
+
+		// ===================================================================
+		// _LbVœK (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+		// LbV̈ʒuƁAc̎Op`璸_ɓ_tA_̍Op`o͂
+		// ===================================================================
+		constexpr unsigned int ForsythCacheSize = 32;
+		constexpr float CacheDecayPower = 1.5f;
+		constexpr float LastTriScore = 0.75f;
+		constexpr float ValenceBoostScale = 2.0f;
+		constexpr float ValenceBoostPower = 0.5f;
+
+		float VertexScore(int cachePosition, unsigned int remaining)
+		{
+			// c̎Op`_͂gȂ
+			if (remaining == 0) return -1.0f;
+
+			float score = 0.0f;
+			if (cachePosition >= 0)
+			{
+				// O̎Op`̒_́AOp`΂葱Ȃ悤
+				if (cachePosition < 3)
+				{
+					score = LastTriScore;
+				}
+				else
+				{
+					float scale = 1.0f / (ForsythCacheSize - 3);
+					score = std::pow(1.0f - (cachePosition - 3) * scale, CacheDecayPower);
+				}
+			}
+
+			// c̎Op`Ȃ_D悷 (ǗOp`cȂ)
+			score += ValenceBoostScale * std::pow(static_cast<float>(remaining), -ValenceBoostPower);
+			return score;
+		}
+
+		void SortForVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount)
+		{
+			const size_t triangleCount = indexCount / 3;
+			if (triangleCount < 2) return;
+
+			// _  Op`̗אڕ\ (c̎Op`擪ɋl߂Ă)
+			std::vector<unsigned int> remaining(vertexCount, 0);
+			for (size_t i = 0; i < indexCount; i++)
+			{
+				remaining[indices[i]]++;
+			}
+			std::vector<unsigned int> offsets(vertexCount + 1, 0);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				offsets[v + 1] = offsets[v] + remaining[v];
+			}
+			std::vector<unsigned int> adjacency(indexCount);
+			{
+				std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+				for (size_t i = 0; i < indexCount; i++)
+				{
+					adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+				}
+			}
+
+			// _̏l
+			std::vector<int> cachePosition(vertexCount, -1);
+			std::vector<float> vertexScore(vertexCount);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				vertexScore[v] = VertexScore(-1, remaining[v]);
+			}
+			std::vector<float> triangleScore(triangleCount);
+			size_t best = 0;
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				const unsigned int* tri = indices + t * 3;
+				triangleScore[t] = vertexScore[tri[0]] + vertexScore[tri[1]] + vertexScore[tri[2]];
+				if (triangleScore[t] > triangleScore[best]) best = t;
+			}
+
+			std::vector<unsigned int> output;
+			output.reserve(indexCount);
+			std::vector<char> emitted(triangleCount, 0);
+			unsigned int cache[ForsythCacheSize + 3];
+			size_t cacheCount = 0;
+			size_t cursor = 0;
+
+			const size_t none = SIZE_MAX;
+			for (size_t n = 0; n < triangleCount; n++)
+			{
+				// LbV̒_Ɍ₪΁A܂o͂ĂȂ擪̎Op`瑱
+				if (best == none)
+				{
+					while (emitted[cursor]) cursor++;
+					best = cursor;
+				}
+
+				const unsigned int* tri = indices + best * 3;
+				output.insert(output.end(), tri, tri + 3);
+				emitted[best] = 1;
+
+				// אڕ\菜
+				for (int k = 0; k < 3; k++)
+				{
+					unsigned int v = tri[k];
+					unsigned int* adj = adjacency.data() + offsets[v];
+					unsigned int count = remaining[v];
+					for (unsigned int j = 0; j < count; j++)
+					{
+						if (adj[j] == best)
+						{
+							adj[j] = adj[count - 1];
+							remaining[v]--;
+							break;
+						}
+					}
+				}
+
+				// LbVXV (̎Op`̒_擪ɁA͂ݏo_͊O)
+				unsigned int newCache[ForsythCacheSize + 3];
+				size_t newCount = 0;
+				for (int k = 0; k < 3; k++)
+				{
+					if (std::find(newCache, newCache + newCount, tri[k]) == newCache + newCount)
+					{
+						newCache[newCount++] = tri[k];
+					}
+				}
+				for (size_t i = 0; i < cacheCount; i++)
+				{
+					if (cache[i] != tri[0] && cache[i] != tri[1] && cache[i] != tri[2])
+					{
+						newCache[newCount++] = cache[i];
+					}
+				}
+				for (size_t i = 0; i < newCount; i++)
+				{
+					unsigned int v = newCache[i];
+					cachePosition[v] = i < ForsythCacheSize ? static_cast<int>(i) : -1;
+					vertexScore[v] = VertexScore(cachePosition[v], remaining[v]);
+				}
+				cacheCount = std::min<size_t>(newCount, ForsythCacheSize);
+				std::copy(newCache, newCache + cacheCount, cache);
+
+				// _ς_gOp`_tA̎Op`I
+				best = none;
+				float bestScore = -1.0f;
+				for (size_t i = 0; i < newCount; i++)
+				{
+					unsigned int v = newCache[i];
+					const unsigned int* adj = adjacency.data() + offsets[v];
+					for (unsigned int j = 0; j < remaining[v]; j++)
+					{
+						unsigned int t = adj[j];
+						const unsigned int* other = indices + t * 3;
+						float score = vertexScore[other[0]] + vertexScore[other[1]] + vertexScore[other[2]];
+						triangleScore[t] = score;
+						if (score > bestScore)
+						{
+							bestScore = score;
+							best = t;
+						}
+					}
+				}
+			}
+
+			std::copy(output.begin(), output.end(), indices);
+		}
+
+		// ===================================================================
+		// I[o[h[œK (Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw")
+		// LbVS_~X̎Op`ŉɋ؂AO򂩂`悤ɉPʂŕבւ
+		// (̒̏Ԃ͕ςȂ̂ŁALbV͋E̕Ȃ)
+		// ===================================================================
+		void OptimizeOverdraw(unsigned int* indices, size_t indexCount, const VERTEX_3D* vertices, size_t vertexCount, float threshold)
+		{
+			const size_t triangleCount = indexCount / 3;
+			if (triangleCount < 2) return;
+
+			// ɋ؂
+			std::vector<size_t> clusters;
+			{
+				FifoCache cache(vertexCount, CacheSize);
+				for (size_t t = 0; t < triangleCount; t++)
+				{
+					const unsigned int* tri = indices + t * 3;
+					int misses = (cache.Access(tri[0]) ? 1 : 0) + (cache.Access(tri[1]) ? 1 : 0) + (cache.Access(tri[2]) ? 1 : 0);
+					if (t == 0 || misses == 3) clusters.push_back(t);
+				}
+			}
+			if (clusters.size() < 2) return;
+			clusters.push_back(triangleCount);
+
+			// Op`̏dSEʐςŏdݕt@
+			auto triangleCentroid = [&](size_t t)
+			{
+				const unsigned int* tri = indices + t * 3;
+				return (vertices[tri[0]].position + vertices[tri[1]].position + vertices[tri[2]].position) / 3.0f;
+			};
+			auto triangleNormal = [&](size_t t)
+			{
+				const unsigned int* tri = indices + t * 3;
+				const auto& p0 = vertices[tri[0]].position;
+				return (vertices[tri[1]].position - p0).Cross(vertices[tri[2]].position - p0);
+			};
+
+			// bVŜ̏dS (ʐςŏdݕt)
+			DirectX::SimpleMath::Vector3 meshCentroid(0.0f, 0.0f, 0.0f);
+			float meshArea = 0.0f;
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				float area = triangleNormal(t).Length();
+				meshCentroid += triangleCentroid(t) * area;
+				meshArea += area;
+			}
+			if (meshArea <= 0.0f) return;
+			meshCentroid /= meshArea;
+
+			// 򂲂Ƃ̌ (dS猩ĂǂꂾOĂ邩B傫̂`)
+			const size_t clusterCount = clusters.size() - 1;
+			std::vector<float> sortKey(clusterCount);
+			for (size_t c = 0; c < clusterCount; c++)
+			{
+				DirectX::SimpleMath::Vector3 centroid(0.0f, 0.0f, 0.0f);
+				DirectX::SimpleMath::Vector3 normal(0.0f, 0.0f, 0.0f);
+				float area = 0.0f;
+				for (size_t t = clusters[c]; t < clusters[c + 1]; t++)
+				{
+					DirectX::SimpleMath::Vector3 n = triangleNormal(t);
+					float a = n.Length();
+					centroid += triangleCentroid(t) * a;
+					normal += n;
+					area += a;
+				}
+				if (area <= 0.0f)
+				{
+					sortKey[c] = 0.0f;
+					continue;
+				}
+				centroid /= area;
+				normal.Normalize();
+				sortKey[c] = (centroid - meshCentroid).Dot(normal);
+			}
+
+			std::vector<size_t> order(clusterCount);
+			std::iota(order.begin(), order.end(), size_t(0));
+			std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKey[a] > sortKey[b]; });
+
+			std::vector<unsigned int> output;
+			output.reserve(indexCount);
+			for (size_t c : order)
+			{
+				output.insert(output.end(), indices + clusters[c] * 3, indices + clusters[c + 1] * 3);
+			}
+
+			// LbVe͈͂𒴂ėȂ̗pȂ
+			size_t before = CountCacheMisses(indices, indexCount, vertexCount, CacheSize);
+			size_t after = CountCacheMisses(output.data(), indexCount, vertexCount, CacheSize);
+			if (after <= before * threshold)
+			{
+				std::copy(output.begin(), output.end(), indices);
+			}
+		}
+
+		// ===================================================================
+		// _tFb`œK (ŏɎg鏇ɒ_ׁAgȂ_̂ĂBԂl͎c_)
+		// ===================================================================
+		size_t OptimizeVertexFetch(VERTEX_3D* destination, unsigned int* indices, size_t indexCount,
+			const VERTEX_3D* vertices, size_t vertexCount)
+		{
+			std::vector<unsigned int> remap(vertexCount, UINT_MAX);
+			unsigned int next = 0;
+			for (size_t i = 0; i < indexCount; i++)
+			{
+				unsigned int& mapped = remap[indices[i]];
+				if (mapped == UINT_MAX)
+				{
+					destination[next] = vertices[indices[i]];
+					mapped = next++;
+				}
+				indices[i] = mapped;
+			}
+			return next;
+		}
+	}
+
+	// ===================================================================
+	// œK
+	// ===================================================================
+	Stats Optimize(std::vector<VERTEX_3D>& vertices, std::vector<unsigned int>& indices, std::vector<SUBSET>& subsets)
+	{
+		Stats stats{};
+		stats.verticesBefore = vertices.size();
+		stats.acmrBefore = ComputeACMR(indices, subsets);
+
+		std::vector<VERTEX_3D> output;
+		output.reserve(vertices.size());
+
+		for (SUBSET& subset : subsets)
+		{
+			const VERTEX_3D* source = vertices.data() + subset.VertexBase;
+			unsigned int* subsetIndices = indices.data() + subset.IndexBase;
+			const size_t vertexCount = subset.VertexNum;
+			const size_t indexCount = subset.IndexNum;
+			const size_t base = output.size();
+
+			// ͈͊OwCfbNXTuZbg͐GȂ
+			bool valid = size_t(subset.VertexBase) + vertexCount <= vertices.size() &&
+				size_t(subset.IndexBase) + indexCount <= indices.size() &&
+				std::all_of(subsetIndices, subsetIndices + indexCount, [vertexCount](unsigned int i) { return i < vertexCount; });
+			if (!valid)
+			{
+				if (size_t(subset.VertexBase) + vertexCount <= vertices.size())
+				{
+					output.insert(output.end(), source, source + vertexCount);
+				}
+				subset.VertexBase = static_cast<unsigned int>(base);
+				continue;
+			}
+
+			WeldVertices(subsetIndices, indexCount, source, vertexCount);
+			OptimizeVertexCache(subsetIndices, indexCount, vertexCount);
+			OptimizeOverdraw(subsetIndices, indexCount, source, vertexCount, OverdrawThreshold);
+
+			output.resize(base + vertexCount);
+			size_t used = OptimizeVertexFetch(output.data() + base, subsetIndices, indexCount, source, vertexCount);
+			output.resize(base + used);
+
+			subset.VertexBase = static_cast<unsigned int>(base);
+			subset.VertexNum = static_cast<unsigned int>(used);
+		}
+
+		vertices.swap(output);
+		stats.verticesAfter = vertices.size();
+		stats.acmrAfter = ComputeACMR(indices, subsets);
+		return stats;
+	}
+
+	// ===================================================================
+	// _LbVœK̂
+	// ===================================================================
+	void OptimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount)
+	{
+		SortForVertexCache(indices, indexCount, vertexCount);
+	}
+
+	// ===================================================================
+	// ACMR ߂
+	// ===================================================================
+	float ComputeACMR(const std::vector<unsigned int>& indices, const std::vector<SUBSET>& subsets, unsigned int cacheSize)
+	{
+		size_t misses = 0;
+		size_t triangles = 0;
+		for (const SUBSET& subset : subsets)
+		{
+			if (size_t(subset.IndexBase) + subset.IndexNum > indices.size()) continue;
+
+			const unsigned int* subsetIndices = indices.data() + subset.IndexBase;
+			size_t vertexCount = 0;
+			for (unsigned int i = 0; i < subset.IndexNum; i++)
+			{
+				vertexCount = std::max<size_t>(vertexCount, size_t(subsetIndices[i]) + 1);
+			}
+			misses += CountCacheMisses(subsetIndices, subset.IndexNum, vertexCount, cacheSize);
+			triangles += subset.IndexNum / 3;
+		}
+		return triangles > 0 ? static_cast<float>(misses) / triangles : 0.0f;
+	}
+}
\ No newline at end of file
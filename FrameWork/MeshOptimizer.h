@@ -0,0 +1,40 @@
+// ===================================================================
+// MeshOptimizer.h
+// ǂݍ񂾃bV̒_ECfbNX̍œK (StaticMesh::Import ĂԁBʂ MeshFile ɕۑ)
+//   1. n           : S_1ɂ܂Ƃ߂
+//   2. _LbV : Oɕϊ_g񂹂鏇ɎOp`בւ (Forsyth)
+//   3. I[o[h[ : LbVقڕۂ܂܁AO򂩂`悤ɕבւ
+//   4. _tFb`   : _g鏇ɕבւAgȂ_̂Ă
+// TuZbgPʂōs (TuZbgE}eA̋E͂܂Ȃ)
+// ===================================================================
+#pragma once
+#include <vector>
+
+#include "renderer.h"
+
+namespace MeshOptimizer
+{
+	// ACMR 𑪂Ƃ̒_LbV (FIFO) ̑傫
+	constexpr unsigned int CacheSize = 16;
+	// I[o[h[œKŋ ACMR ̈ ({)
+	constexpr float OverdrawThreshold = 1.05f;
+
+	// œǨ
+	struct Stats
+	{
+		size_t verticesBefore = 0;
+		size_t verticesAfter = 0;
+		float acmrBefore = 0.0f;	// Op`̕σLbV~X (0.5`3.0BقǗǂ)
+		float acmrAfter = 0.0f;
+	};
+
+	// œK (CfbNX̓TuZbg̑ΒlBVertexBase / VertexNum ͋lߒ)
+	Stats Optimize(std::vector<VERTEX_3D>& vertices, std::vector<unsigned int>& indices, std::vector<SUBSET>& subsets);
+
+	// Op`̏Ԃ𒸓_LbVɕבւ (LOD ̃CfbNXȂǁA_𓮂Ȃ̗p)
+	void OptimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount);
+
+	// ACMR (Average Cache Miss Ratio) ߂
+	float ComputeACMR(const std::vector<unsigned int>& indices, const std::vector<SUBSET>& subsets,
+		unsigned int cacheSize = CacheSize);
+}
\ No newline at end of file
@@ -3,17 +3,25 @@
 #include "IndexBuffer.h"
 #include "Mesh.h"
 
-class MeshRenderer {
+// T ͒_̌`iVERTEX_3D / VERTEX_PACKEDj
+template <typename T = VERTEX_3D> class MeshRenderer {
 protected:
-	VertexBuffer<VERTEX_3D>	m_VertexBuffer;		// _obt@
+	VertexBuffer<T>			m_VertexBuffer;		// _obt@
 	IndexBuffer				m_IndexBuffer;		// CfbNXobt@
 	int						m_IndexNum = 0;		// CfbNX
 public:
-	virtual void Init(Mesh& mesh) 
+	// 쐬 vertices / indices QƂȂ̂ŁAĂяoɉĂ悢
+	virtual void Init(std::span<const T> vertices, std::span<const unsigned int> indices)
 	{
-		m_VertexBuffer.Create(mesh.GetVertices());
-		m_IndexBuffer.Create(mesh.GetIndices());
-		m_IndexNum = static_cast<int>(mesh.GetIndices().size());
+		m_VertexBuffer.Create(vertices);
+		m_IndexBuffer.Create(indices);
+		m_IndexNum = static_cast<int>(indices.size());
+	}
+
+	// CfbNX1oCgi16rbg or 32rbgj
+	unsigned int GetIndexSize() const
+	{
+		return m_IndexBuffer.GetIndexSize();
 	}
 
 	// `O
@@ -31,9 +31,6 @@ private:
     // }eA(TuZbgƂ)
     std::vector<std::unique_ptr<Material>> m_Materials;
 
-    // `wp[(_ECfbNXobt@̊Ǘ)
-    MeshRenderer m_Renderer;
-
     // ff[^pX
     std::string m_modelPath;
 
@@ -43,6 +40,9 @@ private:
     // ς݃tO
     bool m_Initialized = false;
 
+    // Ōɕ`悵 LOD (0 łڍ)
+    size_t m_Lod = 0;
+
 public:
     // ===================================================================
     // RXgN^
@@ -61,10 +61,8 @@ public:
         // bVZbgĂ΃_[
         if (m_Mesh)
         {
-            // MeshRendereri_ECfbNXobt@쐬j
-            m_Renderer.Init(*m_Mesh);
-
             // }eA쐬
+            // (_ECfbNXobt@ StaticMesh ŋL)
             CreateMaterials();
 
             // ς݃tO𗧂Ă
@@ -81,9 +79,10 @@ public:
 
         if (m_Mesh)
         {
-            // MeshRenderer
-            m_Renderer.Init(*m_Mesh);
+            // E{bNXς̂ŋԃCfbNXXV
+            if (m_pOwner) m_pOwner->MarkBoundsDirty();
 
+            // _ECfbNXobt@ StaticMesh ŋL̂ōȂ
             // }eA쐬
             CreateMaterials();
             
@@ -92,11 +91,28 @@ public:
         }
     }
 
+    // `悷郁bV擾
+    std::shared_ptr<StaticMesh> GetMesh() const
+    {
+        return m_Mesh;
+    }
+
+    // Ōɕ`悵 LOD
+    size_t GetLod() const { return m_Lod; }
+
+    // E{bNX (bVݒȂ`Ȃ)
+    bool GetLocalBounds(Bounds& bounds) const override
+    {
+        if (!m_Mesh || m_Mesh->GetVertexCount() == 0) return false;
+        bounds = m_Mesh->GetBounds();    // bVǂݍݎɋ߂
+        return true;
+    }
+
     // ===================================================================
     // VF[_[ݒ
     // ===================================================================
     
-    // gpVF[_[ݒ
+    // gpVF[_[ݒ (StaticMesh ̒_͈kς݂Ȃ̂ VF_PACKED ō)
     void SetShader(std::shared_ptr<Shader> shader)
     {
         m_Shader = shader;
@@ -149,15 +165,21 @@ public:
         Matrix worldMatrix = m_pOwner->GetTransform().GetWorldMatrix();
         // GPUɐݒ
         Renderer::SetWorldMatrix(&worldMatrix);
+        // k_̈ʒu̕ (bV̋E{bNX)
+        Renderer::SetQuantization(m_Mesh->GetQuantization());
 
         // VF[_[ݒ
         m_Shader->SetGPU();
 
-        // `O
-        m_Renderer.BeforeDraw();
+        // `O (L̒_ECfbNXobt@Zbg)
+        auto& renderer = m_Mesh->GetRenderer();
+        renderer.BeforeDraw();
+
+        // ʏ̑傫 LOD I
+        m_Lod = SelectLod(camera, worldMatrix);
 
         // TuZbgƂɕ`
-        const auto& subsets = m_Mesh->GetSubsets();     // TuZbg擾
+        const auto& subsets = m_Mesh->GetSubsets(m_Lod);    // I LOD ̃TuZbg擾
         const auto& textures = m_Mesh->GetTextures();   // eNX`Xg擾
 
         for (size_t i = 0; i < subsets.size(); i++)
@@ -177,7 +199,7 @@ public:
             }
 
             // TuZbg`
-            m_Renderer.DrawSubset(
+            renderer.DrawSubset(
                 subset.IndexNum,    // `悷CfbNX
                 subset.IndexBase,   // CfbNXobt@̊Jnʒu
                 subset.VertexBase   // _obt@̊Jnʒu
@@ -201,6 +223,19 @@ public:
     }
 
 private:
+    // ===================================================================
+    // LOD I
+    // [hԂ̋E{bNX͂ދʂɐ߂傫Ō߂
+    // ===================================================================
+    size_t SelectLod(Camera* camera, const Matrix& worldMatrix) const
+    {
+        if (!camera || m_Mesh->GetLodCount() <= 1) return 0;
+
+        Bounds bounds = m_Mesh->GetBounds().Transformed(worldMatrix);
+        float screenSize = camera->GetScreenSize(bounds.GetCenter(), bounds.GetExtents().Length());
+        return m_Mesh->SelectLod(screenSize);
+    }
+
     // ===================================================================
     // }eA쐬
     // ===================================================================
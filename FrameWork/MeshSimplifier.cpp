@@ -0,0 +1,313 @@
+// ===================================================================
+// MeshSimplifier.cpp
+// 񎟌덷ɂ郁bV̊ȗ
+// ===================================================================
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace MeshSimplifier
+{
+	namespace
+	{
+		using DirectX::SimpleMath::Vector3;
+
+		// ===================================================================
+		// 񎟌덷 (ʂ̕ʂ܂ł̋2̘aAʐςŏdݕt)
+		// ===================================================================
+		struct Quadric
+		{
+			double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+			double b0 = 0, b1 = 0, b2 = 0;
+			double c = 0;
+			double weight = 0;
+
+			//  nEp + d = 0 𑫂
+			void AddPlane(const Vector3& n, float d, float w)
+			{
+				a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z;
+				a11 += w * n.y * n.y; a12 += w * n.y * n.z; a22 += w * n.z * n.z;
+				b0 += w * n.x * d; b1 += w * n.y * d; b2 += w * n.z * d;
+				c += w * d * d;
+				weight += w;
+			}
+
+			void Add(const Quadric& q)
+			{
+				a00 += q.a00; a01 += q.a01; a02 += q.a02; a11 += q.a11; a12 += q.a12; a22 += q.a22;
+				b0 += q.b0; b1 += q.b1; b2 += q.b2;
+				c += q.c;
+				weight += q.weight;
+			}
+
+			// _ p ̌덷 (ʂ܂ł̋2̕)
+			double Evaluate(const Vector3& p) const
+			{
+				double x = p.x, y = p.y, z = p.z;
+				double e = a00 * x * x + a11 * y * y + a22 * z * z +
+					2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+					2.0 * (b0 * x + b1 * y + b2 * z) + c;
+				return weight > 0.0 ? std::max(e, 0.0) / weight : 0.0;
+			}
+		};
+
+		// ǩ (from  to Ɋ񂹂)
+		struct Collapse
+		{
+			unsigned int from;
+			unsigned int to;
+			double cost;
+		};
+
+		// ʒu_܂Ƃ߂ (Ԃl͈ʒuƂ̑\̒_ԍ)
+		std::vector<unsigned int> BuildPositionRemap(const VERTEX_3D* vertices, size_t vertexCount)
+		{
+			struct PositionHash
+			{
+				size_t operator()(const Vector3* p) const
+				{
+					uint32_t bits[3];
+					std::memcpy(bits, p, sizeof(bits));
+					return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+				}
+			};
+			struct PositionEqual
+			{
+				bool operator()(const Vector3* a, const Vector3* b) const
+				{
+					return a->x == b->x && a->y == b->y && a->z == b->z;
+				}
+			};
+
+			std::vector<unsigned int> remap(vertexCount);
+			std::unordered_map<const Vector3*, unsigned int, PositionHash, PositionEqual> unique;
+			unique.reserve(vertexCount);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				remap[v] = unique.try_emplace(&vertices[v].position, static_cast<unsigned int>(v)).first->second;
+			}
+			return remap;
+		}
+
+		// Op`̖@ (KȂB͖ʐς2{)
+		Vector3 TriangleNormal(const Vector3& p0, const Vector3& p1, const Vector3& p2)
+		{
+			return (p1 - p0).Cross(p2 - p0);
+		}
+	}
+
+	// ===================================================================
+	// ȗ
+	// ===================================================================
+	size_t Simplify(unsigned int* destination, const unsigned int* indices, size_t indexCount,
+		const VERTEX_3D* vertices, size_t vertexCount,
+		size_t targetIndexCount, float targetError, float* resultError)
+	{
+		std::vector<unsigned int> result(indices, indices + indexCount);
+		if (resultError) *resultError = 0.0f;
+		if (vertexCount == 0 || indexCount <= targetIndexCount)
+		{
+			std::copy(result.begin(), result.end(), destination);
+			return result.size();
+		}
+
+		// bV̑傫 (덷̊)
+		Vector3 minPos = vertices[0].position;
+		Vector3 maxPos = vertices[0].position;
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			const Vector3& p = vertices[v].position;
+			minPos = Vector3(std::min(minPos.x, p.x), std::min(minPos.y, p.y), std::min(minPos.z, p.z));
+			maxPos = Vector3(std::max(maxPos.x, p.x), std::max(maxPos.y, p.y), std::max(maxPos.z, p.z));
+		}
+		const float extent = (maxPos - minPos).Length();
+		if (extent <= 0.0f)
+		{
+			std::copy(result.begin(), result.end(), destination);
+			return result.size();
+		}
+		const double maxCost = double(targetError) * extent * double(targetError) * extent;
+
+		// Ȃ_
+		//   p: ʒuɕʂ̒_ (UVE@Ⴂ) 
+		//       : 1̎Op`ɂgĂȂӂ̒[
+		std::vector<unsigned int> positionRemap = BuildPositionRemap(vertices, vertexCount);
+		std::vector<char> locked(vertexCount, 0);
+		{
+			std::vector<unsigned int> positionUsers(vertexCount, 0);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				positionUsers[positionRemap[v]]++;
+			}
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				if (positionUsers[positionRemap[v]] > 1) locked[v] = 1;
+			}
+
+			std::unordered_map<uint64_t, unsigned int> edgeCount;
+			edgeCount.reserve(indexCount);
+			auto edgeKey = [](unsigned int a, unsigned int b)
+			{
+				return a < b ? (uint64_t(a) << 32 | b) : (uint64_t(b) << 32 | a);
+			};
+			for (size_t i = 0; i < indexCount; i += 3)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					edgeCount[edgeKey(positionRemap[result[i + k]], positionRemap[result[i + (k + 1) % 3]])]++;
+				}
+			}
+			for (size_t i = 0; i < indexCount; i += 3)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					unsigned int a = result[i + k];
+					unsigned int b = result[i + (k + 1) % 3];
+					if (edgeCount[edgeKey(positionRemap[a], positionRemap[b])] == 1)
+					{
+						locked[a] = 1;
+						locked[b] = 1;
+					}
+				}
+			}
+		}
+
+		// _Ƃ̓񎟌덷 (̎Op`̕)
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t i = 0; i < indexCount; i += 3)
+		{
+			const Vector3& p0 = vertices[result[i + 0]].position;
+			const Vector3& p1 = vertices[result[i + 1]].position;
+			const Vector3& p2 = vertices[result[i + 2]].position;
+			Vector3 normal = TriangleNormal(p0, p1, p2);
+			float area = normal.Length();
+			if (area <= 0.0f) continue;
+			normal /= area;
+			float d = -normal.Dot(p0);
+			for (int k = 0; k < 3; k++)
+			{
+				quadrics[result[i + k]].AddPlane(normal, d, area);
+			}
+		}
+
+		std::vector<unsigned int> remap(vertexCount);
+		std::vector<char> touched(vertexCount);
+		std::vector<unsigned int> offsets(vertexCount + 1);
+		std::vector<unsigned int> adjacency;
+		std::vector<Collapse> collapses;
+		double maxError = 0.0;
+
+		// 1̑ŁA݂ɋ߂Ȃӂ܂Ƃ߂ďk񂷂
+		while (result.size() > targetIndexCount)
+		{
+			const size_t triangleCount = result.size() / 3;
+
+			// _  Op`̗אڕ\
+			std::fill(offsets.begin(), offsets.end(), 0);
+			for (unsigned int v : result) offsets[v + 1]++;
+			for (size_t v = 0; v < vertexCount; v++) offsets[v + 1] += offsets[v];
+			adjacency.resize(result.size());
+			{
+				std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+				for (size_t i = 0; i < result.size(); i++)
+				{
+					adjacency[fill[result[i]]++] = static_cast<unsigned int>(i / 3);
+				}
+			}
+
+			// 덷̏ɕׂ
+			collapses.clear();
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					unsigned int a = result[i + k];
+					unsigned int b = result[i + (k + 1) % 3];
+					if (!locked[a]) collapses.push_back({ a, b, quadrics[a].Evaluate(vertices[b].position) });
+					if (!locked[b]) collapses.push_back({ b, a, quadrics[b].Evaluate(vertices[a].position) });
+				}
+			}
+			std::sort(collapses.begin(), collapses.end(),
+				[](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+			for (size_t v = 0; v < vertexCount; v++) remap[v] = static_cast<unsigned int>(v);
+			std::fill(touched.begin(), touched.end(), 0);
+
+			const size_t removeTarget = triangleCount - targetIndexCount / 3;
+			size_t removed = 0;
+			bool collapsed = false;
+			for (const Collapse& collapse : collapses)
+			{
+				if (collapse.cost > maxCost || removed >= removeTarget) break;
+
+				const unsigned int from = collapse.from;
+				const unsigned int to = collapse.to;
+				if (touched[from] || touched[to]) continue;
+
+				// 񂹂ʁAԂOp`EׂOp`΍sȂ
+				const Vector3& target = vertices[to].position;
+				bool valid = true;
+				size_t degenerate = 0;
+				for (unsigned int j = offsets[from]; j < offsets[from + 1] && valid; j++)
+				{
+					const unsigned int* tri = result.data() + adjacency[j] * 3;
+					if (tri[0] == to || tri[1] == to || tri[2] == to)
+					{
+						degenerate++;
+						continue;
+					}
+
+					Vector3 p[3];
+					for (int k = 0; k < 3; k++) p[k] = vertices[tri[k]].position;
+					Vector3 before = TriangleNormal(p[0], p[1], p[2]);
+					for (int k = 0; k < 3; k++)
+					{
+						if (tri[k] == from) p[k] = target;
+					}
+					Vector3 after = TriangleNormal(p[0], p[1], p[2]);
+					// 傫 (75xȏ) ς̂́AԂE܂ȂƂ݂Ȃ
+					valid = before.Dot(after) > 0.25f * before.Length() * after.Length();
+				}
+				if (!valid || degenerate == 0) continue;
+
+				remap[from] = to;
+				quadrics[to].Add(quadrics[from]);
+				maxError = std::max(maxError, collapse.cost);
+				removed += degenerate;
+				collapsed = true;
+
+				// ̒_͂̑ł͓Ȃ (אڕ\ƗԂ̔Lɕۂ)
+				touched[to] = 1;
+				for (unsigned int j = offsets[from]; j < offsets[from + 1]; j++)
+				{
+					const unsigned int* tri = result.data() + adjacency[j] * 3;
+					touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+				}
+			}
+			if (!collapsed) break;
+
+			// 񂹂_tւāAׂꂽOp`菜
+			size_t write = 0;
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				unsigned int a = remap[result[i + 0]];
+				unsigned int b = remap[result[i + 1]];
+				unsigned int c = remap[result[i + 2]];
+				if (a == b || b == c || c == a) continue;
+				result[write++] = a;
+				result[write++] = b;
+				result[write++] = c;
+			}
+			result.resize(write);
+		}
+
+		if (resultError) *resultError = static_cast<float>(std::sqrt(maxError) / extent);
+		std::copy(result.begin(), result.end(), destination);
+		return result.size();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+// ===================================================================
+// MeshSimplifier.h
+// 񎟌덷 (QEM: Quadric Error Metrics) ɂӂ̏kŃbVȗ (LOD p)
+// _͌̔ẑ܂܎gACfbNX蒼 (LOD ԂŒ_obt@Lł)
+// ̉EUV Ȃǂ̌pڂɂ钸_͓Ȃ (TuZbgԁEpڂ̌ԂȂ)
+// ===================================================================
+#pragma once
+#include <cstddef>
+
+#include "renderer.h"
+
+namespace MeshSimplifier
+{
+	// ȗ (Ԃl destination ɏCfbNX)
+	//   destination      : indexCount ȏ㏑z (indices Ɠł悢)
+	//   targetIndexCount : ܂ŌΏI
+	//   targetError      : 덷 (bV̑傫ɑ΂銄)B𒴂k͂Ȃ
+	//   resultError      : ۂ̌덷 (BsvȂ nullptr)
+	size_t Simplify(unsigned int* destination, const unsigned int* indices, size_t indexCount,
+		const VERTEX_3D* vertices, size_t vertexCount,
+		size_t targetIndexCount, float targetError, float* resultError = nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+// ===================================================================
+// MipmapGenerator.cpp
+// ~bv̐ (sRGB `ɖ߂ 2x2 {bNXtB^)
+// ===================================================================
+#include "MipmapGenerator.h"
+
+#include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <emmintrin.h>
+#endif
+
+namespace MipmapGenerator
+{
+	namespace
+	{
+		// ===================================================================
+		// sRGB  `̕ϊ\
+		// `  sRGB  12rbgɗʎqĈ (Õł덷1iKȓ)
+		// ===================================================================
+		constexpr int LinearSteps = 4096;
+
+		struct ConversionTables
+		{
+			float toLinear[256];
+			uint8_t toSrgb[LinearSteps];
+
+			ConversionTables()
+			{
+				for (int i = 0; i < 256; i++)
+				{
+					float c = i / 255.0f;
+					toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+				for (int i = 0; i < LinearSteps; i++)
+				{
+					float l = i / float(LinearSteps - 1);
+					float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+					toSrgb[i] = static_cast<uint8_t>(std::lround(std::clamp(c, 0.0f, 1.0f) * 255.0f));
+				}
+			}
+		};
+
+		const ConversionTables& GetTables()
+		{
+			static const ConversionTables tables;
+			return tables;
+		}
+
+		// k2E2s (̑傫͍Ō̉fJԂ)
+		struct Taps
+		{
+			uint32_t x0, x1, y0, y1;
+		};
+
+		Taps GetTaps(uint32_t x, uint32_t y, uint32_t srcWidth, uint32_t srcHeight)
+		{
+			return { std::min(2 * x, srcWidth - 1), std::min(2 * x + 1, srcWidth - 1),
+				std::min(2 * y, srcHeight - 1), std::min(2 * y + 1, srcHeight - 1) };
+		}
+
+		// ===================================================================
+		// k (RGBA8  ` RGBA float)B1iڂ̉摜璼ڍ
+		// ===================================================================
+		void DownsampleFromRgba8(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight,
+			float* dst, uint32_t dstWidth, uint32_t dstHeight)
+		{
+			const float* toLinear = GetTables().toLinear;
+			for (uint32_t y = 0; y < dstHeight; y++)
+			{
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					Taps t = GetTaps(x, y, srcWidth, srcHeight);
+					const uint8_t* p[4] = {
+						src + (size_t(t.y0) * srcWidth + t.x0) * 4, src + (size_t(t.y0) * srcWidth + t.x1) * 4,
+						src + (size_t(t.y1) * srcWidth + t.x0) * 4, src + (size_t(t.y1) * srcWidth + t.x1) * 4 };
+					float* out = dst + (size_t(y) * dstWidth + x) * 4;
+#if defined(_XM_SSE_INTRINSICS_)
+					__m128 sum = _mm_setzero_ps();
+					for (const uint8_t* q : p)
+					{
+						sum = _mm_add_ps(sum, _mm_setr_ps(toLinear[q[0]], toLinear[q[1]], toLinear[q[2]], q[3] / 255.0f));
+					}
+					_mm_storeu_ps(out, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+					for (int c = 0; c < 4; c++)
+					{
+						float sum = 0.0f;
+						for (const uint8_t* q : p) sum += c < 3 ? toLinear[q[c]] : q[c] / 255.0f;
+						out[c] = sum * 0.25f;
+					}
+#endif
+				}
+			}
+		}
+
+		// ===================================================================
+		// k (` RGBA float  ` RGBA float)
+		// ===================================================================
+		void Downsample(const float* src, uint32_t srcWidth, uint32_t srcHeight,
+			float* dst, uint32_t dstWidth, uint32_t dstHeight)
+		{
+			for (uint32_t y = 0; y < dstHeight; y++)
+			{
+				const float* row0 = src + size_t(std::min(2 * y, srcHeight - 1)) * srcWidth * 4;
+				const float* row1 = src + size_t(std::min(2 * y + 1, srcHeight - 1)) * srcWidth * 4;
+				float* out = dst + size_t(y) * dstWidth * 4;
+				for (uint32_t x = 0; x < dstWidth; x++)
+				{
+					const size_t x0 = size_t(std::min(2 * x, srcWidth - 1)) * 4;
+					const size_t x1 = size_t(std::min(2 * x + 1, srcWidth - 1)) * 4;
+#if defined(_XM_SSE_INTRINSICS_)
+					__m128 sum = _mm_add_ps(
+						_mm_add_ps(_mm_loadu_ps(row0 + x0), _mm_loadu_ps(row0 + x1)),
+						_mm_add_ps(_mm_loadu_ps(row1 + x0), _mm_loadu_ps(row1 + x1)));
+					_mm_storeu_ps(out + x * 4, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+					for (int c = 0; c < 4; c++)
+					{
+						out[x * 4 + c] = (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c]) * 0.25f;
+					}
+#endif
+				}
+			}
+		}
+
+		// ===================================================================
+		// ` RGBA float  RGBA8 (F sRGB ɖ߂)
+		// ===================================================================
+		void ToRgba8(const float* src, size_t count, uint8_t* dst)
+		{
+			const uint8_t* toSrgb = GetTables().toSrgb;
+#if defined(_XM_SSE_INTRINSICS_)
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 scale = _mm_setr_ps(LinearSteps - 1, LinearSteps - 1, LinearSteps - 1, 255.0f);
+			for (size_t i = 0; i < count; i++)
+			{
+				__m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i * 4), zero), one);
+				alignas(16) int32_t q[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(q), _mm_cvtps_epi32(_mm_mul_ps(v, scale)));
+				dst[i * 4 + 0] = toSrgb[q[0]];
+				dst[i * 4 + 1] = toSrgb[q[1]];
+				dst[i * 4 + 2] = toSrgb[q[2]];
+				dst[i * 4 + 3] = static_cast<uint8_t>(q[3]);
+			}
+#else
+			for (size_t i = 0; i < count; i++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					dst[i * 4 + c] = toSrgb[std::lround(std::clamp(src[i * 4 + c], 0.0f, 1.0f) * (LinearSteps - 1))];
+				}
+				dst[i * 4 + 3] = static_cast<uint8_t>(std::lround(std::clamp(src[i * 4 + 3], 0.0f, 1.0f) * 255.0f));
+			}
+#endif
+		}
+	}
+
+	// ===================================================================
+	// i
+	// ===================================================================
+	uint32_t GetMipCount(uint32_t width, uint32_t height)
+	{
+		uint32_t count = 1;
+		while (width > 1 || height > 1)
+		{
+			width = std::max(1u, width / 2);
+			height = std::max(1u, height / 2);
+			count++;
+		}
+		return count;
+	}
+
+	// ===================================================================
+	// ~bvSč
+	// ===================================================================
+	std::vector<MipLevel> Generate(const uint8_t* rgba, uint32_t width, uint32_t height)
+	{
+		std::vector<MipLevel> levels;
+		if (rgba == nullptr || width == 0 || height == 0) return levels;
+
+		levels.reserve(GetMipCount(width, height));
+		levels.push_back({ width, height, std::vector<uint8_t>(rgba, rgba + size_t(width) * height * 4) });
+
+		// O̒i (`) cĂA̒i͂
+		std::vector<float> previous;
+		std::vector<float> current;
+		while (width > 1 || height > 1)
+		{
+			uint32_t nextWidth = std::max(1u, width / 2);
+			uint32_t nextHeight = std::max(1u, height / 2);
+			current.resize(size_t(nextWidth) * nextHeight * 4);
+			if (previous.empty())
+			{
+				DownsampleFromRgba8(rgba, width, height, current.data(), nextWidth, nextHeight);
+			}
+			else
+			{
+				Downsample(previous.data(), width, height, current.data(), nextWidth, nextHeight);
+			}
+
+			MipLevel level{ nextWidth, nextHeight, std::vector<uint8_t>(size_t(nextWidth) * nextHeight * 4) };
+			ToRgba8(current.data(), size_t(nextWidth) * nextHeight, level.pixels.data());
+			levels.push_back(std::move(level));
+
+			std::swap(previous, current);
+			width = nextWidth;
+			height = nextHeight;
+		}
+		return levels;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+// ===================================================================
+// MipmapGenerator.h
+// RGBA8 摜~bvSč (ϊς݃eNX`p)
+// F sRGB ƂĈA`ɖ߂Ă 2x2 ̕ς (ÂɊȂ)
+// At@͂̂܂ܕςB1iƂɑO̒i (`E) ASIMD 4`l܂Ƃ߂ČvZ
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace MipmapGenerator
+{
+	// ~bv1i
+	struct MipLevel
+	{
+		uint32_t width;
+		uint32_t height;
+		std::vector<uint8_t> pixels;	// RGBA8
+	};
+
+	// ~bvSč (Ԃl [0] ͌̉摜̕BŌ 1x1)
+	std::vector<MipLevel> Generate(const uint8_t* rgba, uint32_t width, uint32_t height);
+
+	// i (1x1 ܂)
+	uint32_t GetMipCount(uint32_t width, uint32_t height);
+}
\ No newline at end of file
@@ -18,6 +18,8 @@ void PhysicsManager::Init()
     // RC_[XgNA
     m_Colliders.clear();
     m_PreviousCollisions.clear();
+    m_RemovedDuringUpdate.clear();
+    m_IsIterating = false;
 
     // ftHg̏d͐ݒiYj
     m_Gravity = Vector3(0.0f, -9.8f, 0.0f);
@@ -110,7 +112,22 @@ void PhysicsManager::UnregisterCollider(Collider* collider)
     auto it = std::find(m_Colliders.begin(), m_Colliders.end(), collider);
     if (it != m_Colliders.end())
     {
-        m_Colliders.erase(it);
+        if (m_IsIterating)
+        {
+            // ͋l߂ɋ󂯂Ă ( CleanupInvalidColliders ŏO)
+            *it = nullptr;
+            m_RemovedDuringUpdate.push_back(collider);
+        }
+        else
+        {
+            m_Colliders.erase(it);
+        }
+
+        // Ot[̏Փ˗ (͑ɂ܂Ƃ߂ď)
+        if (!m_IsIterating)
+        {
+            PurgeCollisionPairs(collider);
+        }
 
 #ifdef DEBUG
         std::cout << "[PhysicsManager] Collider unregistered. Total: "
@@ -161,6 +178,10 @@ void PhysicsManager::CheckCollisions()
     // t[̏Փ˂L^
     std::unordered_set<CollisionPair, CollisionPair::Hash> currentCollisions;
 
+    // R[obNŃRC_[ĂXgl߂Ȃ
+    m_IsIterating = true;
+    m_RemovedDuringUpdate.clear();
+
     // SRC_[yA`FbN
     for (size_t i = 0; i < m_Colliders.size(); i++)
     {
@@ -191,9 +212,13 @@ void PhysicsManager::CheckCollisions()
                     info.otherCollider = col2;
                     col1->OnCollisionStay(info);
 
-                    info.other = col1->GetOwner();
-                    info.otherCollider = col1;
-                    col2->OnCollisionStay(info);
+                    // R[obNő肪ꂽꍇ͒ʒmȂ
+                    if (m_Colliders[j] == col2 && m_Colliders[i] == col1)
+                    {
+                        info.other = col1->GetOwner();
+                        info.otherCollider = col1;
+                        col2->OnCollisionStay(info);
+                    }
                 }
                 else
                 {
@@ -202,18 +227,38 @@ void PhysicsManager::CheckCollisions()
                     info.otherCollider = col2;
                     col1->OnCollisionEnter(info);
 
-                    info.other = col1->GetOwner();
-                    info.otherCollider = col1;
-                    col2->OnCollisionEnter(info);
+                    // R[obNő肪ꂽꍇ͒ʒmȂ
+                    if (m_Colliders[j] == col2 && m_Colliders[i] == col1)
+                    {
+                        info.other = col1->GetOwner();
+                        info.otherCollider = col1;
+                        col2->OnCollisionEnter(info);
+                    }
                 }
             }
         }
     }
 
+    // ɉꂽRC_[܂ރyA͗̋L^珜
+    for (Collider* removed : m_RemovedDuringUpdate)
+    {
+        std::erase_if(currentCollisions, [removed](const CollisionPair& pair) {
+            return pair.collider1 == removed || pair.collider2 == removed;
+        });
+        PurgeCollisionPairs(removed);
+    }
+    m_RemovedDuringUpdate.clear();
+
     // OnCollisionExit 
     // iOt[ɂčt[ɂȂՓˁj
     for (const auto& pair : m_PreviousCollisions)
     {
+        // Exit ̃R[obNŉꂽRC_[ɂ͒ʒmȂ
+        if (IsRemovedDuringUpdate(pair.collider1) || IsRemovedDuringUpdate(pair.collider2))
+        {
+            continue;
+        }
+
         if (currentCollisions.find(pair) == currentCollisions.end())
         {
             // Փ˂I
@@ -223,14 +268,45 @@ void PhysicsManager::CheckCollisions()
             info.otherCollider = pair.collider2;
             pair.collider1->OnCollisionExit(info);
 
-            info.other = pair.collider1->GetOwner();
-            info.otherCollider = pair.collider1;
-            pair.collider2->OnCollisionExit(info);
+            if (!IsRemovedDuringUpdate(pair.collider1) && !IsRemovedDuringUpdate(pair.collider2))
+            {
+                info.other = pair.collider1->GetOwner();
+                info.otherCollider = pair.collider1;
+                pair.collider2->OnCollisionExit(info);
+            }
         }
     }
 
+    m_IsIterating = false;
+
     // Ot[̏Փ˂XV
     m_PreviousCollisions = std::move(currentCollisions);
+
+    // Exit ̃R[obNɉꂽ̂𗚗珜
+    for (Collider* removed : m_RemovedDuringUpdate)
+    {
+        PurgeCollisionPairs(removed);
+    }
+    m_RemovedDuringUpdate.clear();
+}
+
+// ===================================================================
+// ɉꂽRC_[
+// ===================================================================
+bool PhysicsManager::IsRemovedDuringUpdate(const Collider* collider) const
+{
+    return std::find(m_RemovedDuringUpdate.begin(), m_RemovedDuringUpdate.end(), collider)
+        != m_RemovedDuringUpdate.end();
+}
+
+// ===================================================================
+// wRC_[܂ޏՓ˃yA𗚗
+// ===================================================================
+void PhysicsManager::PurgeCollisionPairs(const Collider* collider)
+{
+    std::erase_if(m_PreviousCollisions, [collider](const CollisionPair& pair) {
+        return pair.collider1 == collider || pair.collider2 == collider;
+    });
 }
 
 // ===================================================================
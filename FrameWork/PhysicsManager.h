@@ -34,6 +34,11 @@ private:
     // d͉x
     Vector3 m_Gravity;
 
+    // Փ˔̑ (̉̓Xgl߂Ɍł܂Ƃ߂Ĕf)
+    bool m_IsIterating = false;
+    // ɉꂽRC_[
+    std::vector<Collider*> m_RemovedDuringUpdate;
+
     // fobO`tO
 #ifdef DEBUG
     bool m_DebugDraw;
@@ -87,6 +92,12 @@ private:
 
     // ȃRC_[폜
     void CleanupInvalidColliders();
+
+    // wRC_[܂ޏՓ˃yA𗚗 (ς݂̃RC_[Exit𑗂Ȃ)
+    void PurgeCollisionPairs(const Collider* collider);
+
+    // ɉꂽRC_[
+    bool IsRemovedDuringUpdate(const Collider* collider) const;
 };
 
 // ===================================================================
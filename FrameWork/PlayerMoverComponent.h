@@ -24,6 +24,17 @@ public:
     {
     }
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    static constexpr const char* TypeName = "PlayerMoverComponent";
+    static constexpr auto ReflectFields()
+    {
+        return std::make_tuple(
+            MakeField("MoveSpeed", &PlayerMoverComponent::m_MoveSpeed),
+            MakeField("RotationSpeed", &PlayerMoverComponent::m_RotationSpeed));
+    }
+
     // ===================================================================
     // XV
     // ===================================================================
@@ -31,7 +42,7 @@ public:
     {
         if (!m_pOwner) return;
 
-        float deltaTime = Game::GetDeltaTime();
+        float deltaTime = GetDeltaTime();
         Transform& transform = m_pOwner->GetTransform();
 
         // ړ
@@ -0,0 +1,42 @@
+// ===================================================================
+// Prefab.h
+// pɂɐEjIuWFNgieEGtFNgj̃ev[g
+// SceneBase::RegisterPrefab œo^ASpawn / Despawn Ŏg
+// ===================================================================
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "SystemCommon.h"
+
+class GameObject;
+
+// ===================================================================
+// Prefab
+// ̎pE^OƁAR|[lggݗĂ֐
+// ===================================================================
+struct Prefab
+{
+	std::string name = "";		// GameObject
+	std::string tag = "";		// ^O
+
+	// p (ėp Transform::Reset ł̒lɖ߂)
+	Vector3 position = Vector3(0.0f, 0.0f, 0.0f);
+	Vector3 rotation = Vector3(0.0f, 0.0f, 0.0f);
+	Vector3 scale = Vector3(1.0f, 1.0f, 1.0f);
+
+	// R|[lg̒ǉȂǁACX^X̑gݗ (VK̂݌Ă΂)
+	std::function<void(GameObject*)> build;
+};
+
+// ===================================================================
+// PrefabPool
+// Prefab 1̃CX^Xu (SceneBase ێ)
+// ===================================================================
+struct PrefabPool
+{
+	Prefab prefab;							// ev[g
+	std::vector<GameObject*> inactive;		// ėp҂̃CX^X
+	size_t instanceCount = 0;				// ς݂̃CX^X
+};
\ No newline at end of file
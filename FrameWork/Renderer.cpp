@@ -26,6 +26,7 @@ ID3D11Buffer* Renderer::m_pProjectionBuffer{}; // 
 ID3D11Buffer* Renderer::m_pLightBuffer{}; // Cgݒisj
 ID3D11Buffer* Renderer::m_pMaterialBuffer{};	// }eAݒ
 ID3D11Buffer* Renderer::m_pTextureBuffer{};		// UVݒ
+ID3D11Buffer* Renderer::m_pQuantizationBuffer{};	// k_̕ݒ
 
 // fvXXeVXe[g
 ID3D11DepthStencilState* Renderer::m_pDepthStateEnable{};
@@ -211,6 +212,12 @@ HRESULT Renderer::Init()
 	m_pDeviceContext->VSSetConstantBuffers(5, 1, &m_pTextureBuffer);
 	if (FAILED(hr)) return hr;
 
+	// 6ԖځFk_̕
+	bufferDesc.ByteWidth = sizeof(QUANTIZATION);
+	hr = m_pDevice->CreateBuffer(&bufferDesc, NULL, &m_pQuantizationBuffer);
+	m_pDeviceContext->VSSetConstantBuffers(6, 1, &m_pQuantizationBuffer);
+	if (FAILED(hr)) return hr;
+
 	// Cg
 	LIGHT light{};
 	light.Enable = true;
@@ -291,6 +298,7 @@ void Renderer::Uninit()
 	SAFE_RELEASE(m_pLightBuffer);
 	SAFE_RELEASE(m_pMaterialBuffer);
 	SAFE_RELEASE(m_pTextureBuffer);
+	SAFE_RELEASE(m_pQuantizationBuffer);
 
 	SAFE_RELEASE(m_pWorldBuffer);
 	SAFE_RELEASE(m_pViewBuffer);
@@ -366,6 +374,14 @@ void Renderer::SetUV(float u, float v, float uw, float vh)
 		m_pTextureBuffer, 0, NULL, &mat, 0, 0);
 }
 
+//--------------------------------------------------------------------------------------
+// k_̕ݒ
+//--------------------------------------------------------------------------------------
+void Renderer::SetQuantization(QUANTIZATION Quantization)
+{
+	m_pDeviceContext->UpdateSubresource(m_pQuantizationBuffer, 0, NULL, &Quantization, 0, 0);
+}
+
 //--------------------------------------------------------------------------------------
 // [xXeV̗LEݒ
 //--------------------------------------------------------------------------------------
@@ -622,7 +638,7 @@ HRESULT Renderer::CompileShader(const char* szFileName, LPCSTR szEntryPoint, LPC
 //--------------------------------------------------------------------------------------
 // _VF[_[IuWFNg𐶐
 //--------------------------------------------------------------------------------------
-HRESULT Renderer::CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppVertexLayout, D3D11_INPUT_ELEMENT_DESC* pLayout, unsigned int numElements, const char* szFileName)
+HRESULT Renderer::CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppVertexLayout, D3D11_INPUT_ELEMENT_DESC* pLayout, unsigned int numElements, const char* szFileName, unsigned int* pObjectSize)
 {
 	void* ShaderObject;
 	int	ShaderObjectSize;
@@ -633,6 +649,7 @@ HRESULT Renderer::CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11
 
 	// foCXgĒ_VF[_[쐬
 	hr = m_pDevice->CreateVertexShader(ShaderObject, ShaderObjectSize, NULL, ppVertexShader);
+	if (pObjectSize) *pObjectSize = static_cast<unsigned int>(ShaderObjectSize);
 
 	// foCXgĒ_CAEg쐬
 	m_pDevice->CreateInputLayout(pLayout, numElements, ShaderObject, ShaderObjectSize, ppVertexLayout);
@@ -643,7 +660,7 @@ HRESULT Renderer::CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11
 //--------------------------------------------------------------------------------------
 // sNZVF[_[IuWFNg𐶐
 //--------------------------------------------------------------------------------------
-HRESULT Renderer::CreatePixelShader(ID3D11PixelShader** ppPixelShader, const char* szFileName)
+HRESULT Renderer::CreatePixelShader(ID3D11PixelShader** ppPixelShader, const char* szFileName, unsigned int* pObjectSize)
 {
 	void* ShaderObject;
 	int	ShaderObjectSize;
@@ -655,6 +672,7 @@ HRESULT Renderer::CreatePixelShader(ID3D11PixelShader** ppPixelShader, const cha
 	// sNZVF[_[𐶐
 	hr = m_pDevice->CreatePixelShader(ShaderObject, ShaderObjectSize, nullptr, ppPixelShader);
 	if (FAILED(hr)) return hr;
+	if (pObjectSize) *pObjectSize = static_cast<unsigned int>(ShaderObjectSize);
 
 	return S_OK;
 }
@@ -665,7 +683,8 @@ HRESULT Renderer::CreatePixelShader(ID3D11PixelShader** ppPixelShader, const cha
 bool Renderer::CreateIndexBuffer(
 	unsigned int indexnum,						// CfbNX
 	void* indexdata,							// CfbNXf[^i[擪AhX
-	ID3D11Buffer** pIndexBuffer) {				// CfbNXobt@
+	ID3D11Buffer** pIndexBuffer,				// CfbNXobt@
+	unsigned int indexsize) {					// CfbNX1oCgi2 or 4j
 
 	// CfbNXobt@
 	D3D11_BUFFER_DESC bd;
@@ -673,7 +692,7 @@ bool Renderer::CreateIndexBuffer(
 
 	ZeroMemory(&bd, sizeof(bd));
 	bd.Usage = D3D11_USAGE_DEFAULT;								// obt@gp
-	bd.ByteWidth = sizeof(unsigned int) * indexnum;				// obt@̑傫
+	bd.ByteWidth = indexsize * indexnum;						// obt@̑傫
 	bd.BindFlags = D3D11_BIND_INDEX_BUFFER;						// CfbNXobt@
 	bd.CPUAccessFlags = 0;										// CPUANZXsv
 
@@ -6,6 +6,7 @@
 #include	<SimpleMath.h>
 #include	<io.h>
 #include	<string>
+#include	<cstdint>
 #include	<vector>
 #include	<d3dcompiler.h>
 #include	<locale.h>
@@ -27,6 +28,29 @@ struct VERTEX_3D
 	DirectX::SimpleMath::Vector2 uv;
 };
 
+// kRc_f[^i20oCgBϊς݃bVpBVertexPacker ōj
+struct VERTEX_PACKED
+{
+	uint16_t position[4];	// E{bNẌʒuiUNORM16Bw ͖gpj
+	int16_t normal[2];		// ʑ̂ɓWJ@iSNORM16j
+	uint8_t color[4];		// _J[iUNORM8j
+	uint16_t uv[2];			// eNX`Wixj
+};
+
+// _̌`iVF[_[̓̓CAEgj
+enum EVertexFormat {
+	VF_3D = 0,								// VERTEX_3D
+	VF_PACKED,								// VERTEX_PACKED
+	MAX_VERTEXFORMAT
+};
+
+// k_̈ʒu̕iʒu = l * Scale + Offsetj
+struct QUANTIZATION
+{
+	DirectX::SimpleMath::Vector4 PositionOffset;	// E{bNX̍ŏ_
+	DirectX::SimpleMath::Vector4 PositionScale;		// E{bNX̑傫
+};
+
 // uhXe[g
 enum EBlendState {
 	BS_NONE = 0,							// 
@@ -90,6 +114,7 @@ private:
 	static ID3D11Buffer*			m_pLightBuffer;
 	static ID3D11Buffer*			m_pMaterialBuffer;
 	static ID3D11Buffer*			m_pTextureBuffer;
+	static ID3D11Buffer*			m_pQuantizationBuffer;
 
 	static ID3D11DepthStencilState* m_pDepthStateEnable;
 	static ID3D11DepthStencilState* m_pDepthStateDisable;
@@ -121,10 +146,11 @@ public:
 	static ID3D11DeviceContext* GetDeviceContext( void ){ return m_pDeviceContext; }
 
 	static HRESULT CompileShader(const char* szFileName, LPCSTR szEntryPoint, LPCSTR szShaderModel, void** ppShaderObject, int* pShaderObjectSize);
-	static HRESULT CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppVertexLayout, D3D11_INPUT_ELEMENT_DESC* pLayout, unsigned int numElements, const char* szFileName);
-	static HRESULT CreatePixelShader(ID3D11PixelShader** PixelShader, const char* FileName);
+	// pObjectSize ɂ̓RpCς݂̃oCgR[h̑傫Ԃ (svȂ nullptr)
+	static HRESULT CreateVertexShader(ID3D11VertexShader** ppVertexShader, ID3D11InputLayout** ppVertexLayout, D3D11_INPUT_ELEMENT_DESC* pLayout, unsigned int numElements, const char* szFileName, unsigned int* pObjectSize = nullptr);
+	static HRESULT CreatePixelShader(ID3D11PixelShader** PixelShader, const char* FileName, unsigned int* pObjectSize = nullptr);
 
-	static bool CreateIndexBuffer(unsigned int indexnum, void* indexdata, ID3D11Buffer** pIndexBuffer);
+	static bool CreateIndexBuffer(unsigned int indexnum, void* indexdata, ID3D11Buffer** pIndexBuffer, unsigned int indexsize = sizeof(unsigned int));
 	static bool CreateVertexBuffer(unsigned int stride, unsigned int vertexnum, void* vertexdata, ID3D11Buffer** pVertexBuffer);
 	static bool CreateVertexBufferWrite(unsigned int stride, unsigned int vertexnum, void* vertexdata, ID3D11Buffer** pVertexBuffer);
 
@@ -133,6 +159,7 @@ public:
 	static void SetLight(LIGHT light);
 	static void SetMaterial(MATERIAL Material);
 	static void SetUV(float u, float v, float uw, float vh);
+	static void SetQuantization(QUANTIZATION Quantization);
 	//=============================================================================
 	// uh Xe[gݒ
 	//=============================================================================
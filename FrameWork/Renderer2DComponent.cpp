@@ -1,5 +1,6 @@
 #include "Renderer2DComponent.h"
 #include "GameObject.h"
+#include "ResourceManager.h"
 
 // O錾NX̃wb_[
 #include "Camera.h"
@@ -69,22 +70,14 @@ void Renderer2DComponent::Update()
 //=======================================
 void Renderer2DComponent::Draw(Camera* camera)
 {
+	// eNX`̓ǂݍݒ͕`悵Ȃ
+	if (m_Texture.IsValid() && !m_Texture.IsDone()) return;
 
 	//JI
 	camera->SetCamera();
 
-	Transform& m_Transform = m_pOwner->GetTransform();
-	Vector3 m_Rotation = m_Transform.GetRotation();
-	Vector3 m_Position = m_Transform.GetPosition();
-	Vector3 m_Scale = m_Transform.GetScale();
-
-	// [hs̍쐬
-	Matrix r = Matrix::CreateFromYawPitchRoll(m_Rotation.y, m_Rotation.x, m_Rotation.z);
-	Matrix t = Matrix::CreateTranslation(m_Position.x, m_Position.y, m_Position.z);
-	Matrix s = Matrix::CreateScale(m_Scale.x, m_Scale.y, m_Scale.z);
-
-	Matrix worldmtx;
-	worldmtx = s * r * t;
+	// [hs̎擾iTransformŃLbVς݁j
+	Matrix worldmtx = m_pOwner->GetTransform().GetWorldMatrix();
 	Renderer::SetWorldMatrix(&worldmtx); // GPUɃZbg
 
 	// `̏
@@ -99,7 +92,10 @@ void Renderer2DComponent::Draw(Camera* camera)
 	m_VertexBuffer.SetGPU();
 	m_IndexBuffer.SetGPU();
 
-	m_Texture.SetGPU();
+	if (auto texture = m_Texture.Get())
+	{
+		texture->SetGPU();
+	}
 	m_Material->SetGPU();
 
 	// UV̐ݒw
@@ -127,9 +123,8 @@ void Renderer2DComponent::Uninit()
 // eNX`w
 void Renderer2DComponent::SetTexture(const char* imgname)
 {
-	// eNX`[h
-	bool sts = m_Texture.Load(imgname);
-	assert(sts == true);
+	// eNX`[h (LbVς݂Ȃ瑦ɎgBSetUV Ő؂oAgX̂ňkE~bv)
+	m_Texture = M_RESOURCE.LoadTextureAsync(imgname, TF_RGBA8);
 }
 
 // ʒuw
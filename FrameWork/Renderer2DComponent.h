@@ -3,6 +3,7 @@
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
 #include "Texture.h"
+#include "ResourceHandle.h"
 #include "Material.h"
 #include "Shader.h"
 
@@ -30,7 +31,7 @@ private:
 	VertexBuffer<VERTEX_3D> m_VertexBuffer; // _obt@
 
 	// `ׂ̈̏iڂɊւ镔j
-	Texture m_Texture; // eNX`
+	ResourceHandle<Texture> m_Texture; // eNX` (񓯊ǂݍ݁Bǂݍݒ͕`悵Ȃ)
 	std::unique_ptr<Material> m_Material; //}eA
 	
 	Shader m_Shader;	// VF[_[
@@ -54,7 +55,7 @@ public:
 	void Draw(Camera* camera);
 	void Uninit();
 
-	// eNX`w
+	// eNX`w (ǂݍ݂̓[J[ōsAɕ`悳)
 	void SetTexture(const char* imgname);
 
 	// ʒuw
@@ -0,0 +1,72 @@
+// ===================================================================
+// ResourceHandle.h
+// 񓯊ǂݍݒ̃\[Xւ̎Q (ResourceManager::LoadXXXAsync Ԃ)
+// ǂݍ݂I Get() Œg悤ɂȂ
+// t@Cǂݍݒɗvꍇ́AvLnhԂ
+// ===================================================================
+#pragma once
+#include <atomic>
+#include <memory>
+
+// ǂݍ݂̏
+enum class ResourceState
+{
+	Loading,	// ǂݍݒ ([J[ŃfR[hA܂GPU]҂)
+	Ready,		// 
+	Failed,		// s
+};
+
+// ===================================================================
+// ǂݍݗv (nhԂŋL)
+// ===================================================================
+template<typename T>
+struct ResourceRequest
+{
+	std::atomic<ResourceState> state{ ResourceState::Loading };
+	std::shared_ptr<T> resource;	// state  Ready ɂȂĂǂ (CXbhŏ)
+
+	//  (resource  nullptr Ȃ玸s)
+	void Complete(std::shared_ptr<T> result)
+	{
+		resource = std::move(result);
+		state.store(resource ? ResourceState::Ready : ResourceState::Failed, std::memory_order_release);
+	}
+};
+
+// ===================================================================
+// nh
+// ===================================================================
+template<typename T>
+class ResourceHandle
+{
+private:
+	std::shared_ptr<ResourceRequest<T>> m_Request;
+
+public:
+	ResourceHandle() = default;
+	explicit ResourceHandle(std::shared_ptr<ResourceRequest<T>> request)
+		: m_Request(std::move(request)) {}
+
+	// ǂݍݍς݂̃\[X
+	static ResourceHandle FromResource(std::shared_ptr<T> resource)
+	{
+		auto request = std::make_shared<ResourceRequest<T>>();
+		request->Complete(std::move(resource));
+		return ResourceHandle(std::move(request));
+	}
+
+	//  (̃nh Failed)
+	ResourceState GetState() const
+	{
+		return m_Request ? m_Request->state.load(std::memory_order_acquire) : ResourceState::Failed;
+	}
+	bool IsValid() const { return m_Request != nullptr; }
+	bool IsReady() const { return GetState() == ResourceState::Ready; }
+	bool IsFailed() const { return GetState() == ResourceState::Failed; }
+	bool IsDone() const { return GetState() != ResourceState::Loading; }
+
+	// ǂݍݍς݂Ȃ烊\[XAǂݍݒEsȂ nullptr
+	std::shared_ptr<T> Get() const { return IsReady() ? m_Request->resource : nullptr; }
+
+	void Reset() { m_Request.reset(); }
+};
\ No newline at end of file
@@ -2,7 +2,13 @@
 #include "Texture.h"
 #include "StaticMesh.h"
 #include "Shader.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 // ===================================================================
 // 
@@ -18,35 +24,46 @@ void ResourceManager::Init()
 void ResourceManager::UnInit()
 {
     std::cout << "[ResourceManager] Uninitializing..." << std::endl;
+
+    // ]Ȃǂݍ݂͎̂Ă ([J[͒~ς)
+    {
+        std::lock_guard<std::mutex> lock(m_UploadMutex);
+        m_UploadQueue.clear();
+    }
     ClearAll();
 }
 
 // ===================================================================
 // eNX`ǂݍ (LbVp)
 // ===================================================================
-std::shared_ptr<Texture> ResourceManager::LoadTexture(const std::string& filepath)
+std::shared_ptr<Texture> ResourceManager::LoadTexture(const std::string& filepath, ETextureFormat format)
 {
+    // L[𐶐 (摜ł`ႦΕʂ̃eNX`)
+    std::string key = MakeTextureKey(filepath, format);
+
     // LbVɑ݂邩mF
-    auto it = m_TextureCache.find(filepath);
-    if (it != m_TextureCache.end())
     {
-        std::cout << "[ResourceManager] Texture cache hit: " << filepath << std::endl;
-        return it->second; // LbVԂ
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (auto texture = FindCached(m_TextureCache, key))
+        {
+            std::cout << "[ResourceManager] Texture cache hit: " << key << std::endl;
+            return texture; // LbVԂ
+        }
     }
 
     // VKǂݍ
-    std::cout << "[ResourceManager] Loading texture: " << filepath << std::endl;
+    std::cout << "[ResourceManager] Loading texture: " << key << std::endl;
     auto texture = std::make_shared<Texture>();
 
-    if (!texture->Load(filepath))
+    if (!texture->Load(filepath, format))
     {
-        std::cerr << "[ResourceManager] Failed to load texture: " << filepath << std::endl;
+        std::cerr << "[ResourceManager] Failed to load texture: " << key << std::endl;
         return nullptr;
     }
 
-    // LbVɕۑ
-    m_TextureCache[filepath] = texture;
-    return texture;
+    // LbVɕۑ (񓯊ǂݍ݂Őɓo^Ă΂g)
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return AddCached(m_TextureCache, key, texture, texture->GetCpuBytes(), texture->GetGpuBytes());
 }
 
 // ===================================================================
@@ -54,16 +71,28 @@ std::shared_ptr<Texture> ResourceManager::LoadTexture(const std::string& filepat
 // ===================================================================
 std::shared_ptr<StaticMesh> ResourceManager::LoadMesh(const std::string& filepath,
     const std::string& textureDir)
+{
+    // CPU̓ǂݍ  GPU]ELbVo^
+    return UploadMesh(filepath, ImportMesh(filepath, textureDir));
+}
+
+// ===================================================================
+// bVCPUǂݍ ([J[Xbh)
+// ===================================================================
+std::shared_ptr<StaticMesh> ResourceManager::ImportMesh(const std::string& filepath,
+    const std::string& textureDir)
 {
     // LbVɑ݂邩mF
-    auto it = m_MeshCache.find(filepath);
-    if (it != m_MeshCache.end())
     {
-        std::cout << "[ResourceManager] Mesh cache hit: " << filepath << std::endl;
-        return it->second;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (auto mesh = FindCached(m_MeshCache, filepath))
+        {
+            std::cout << "[ResourceManager] Mesh cache hit: " << filepath << std::endl;
+            return mesh;
+        }
     }
 
-    // VKǂݍ
+    // VKǂݍ (bN̊Oōs)
     std::cout << "[ResourceManager] Loading mesh: " << filepath << std::endl;
     auto mesh = std::make_shared<StaticMesh>();
 
@@ -78,37 +107,250 @@ std::shared_ptr<StaticMesh> ResourceManager::LoadMesh(const std::string& filepat
         return nullptr;
     }
 
-    // LbVɕۑ
-    m_MeshCache[filepath] = mesh;
     return mesh;
 }
 
+// ===================================================================
+// bVGPU]ƃLbVo^ (CXbh)
+// ===================================================================
+std::shared_ptr<StaticMesh> ResourceManager::UploadMesh(const std::string& filepath,
+    std::shared_ptr<StaticMesh> mesh)
+{
+    if (!mesh)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // ʌoHŐɓo^Ă΂g
+    if (auto cached = FindCached(m_MeshCache, filepath))
+    {
+        return cached;
+    }
+
+    // eNX`GPUɓ]
+    mesh->Upload();
+
+    // LbVɕۑ
+    return AddCached(m_MeshCache, filepath, mesh, mesh->GetCpuBytes(), mesh->GetGpuBytes());
+}
+
+// ===================================================================
+// eNX`̔񓯊ǂݍ
+// ===================================================================
+ResourceHandle<Texture> ResourceManager::LoadTextureAsync(const std::string& filepath, ETextureFormat format)
+{
+    // L[𐶐 (摜ł`ႦΕʂ̗v)
+    std::string key = MakeTextureKey(filepath, format);
+
+    auto request = std::make_shared<ResourceRequest<Texture>>();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // ǂݍݍς
+        if (auto texture = FindCached(m_TextureCache, key))
+        {
+            return ResourceHandle<Texture>::FromResource(texture);
+        }
+
+        // ǂݍݒ  vL
+        auto [pending, inserted] = m_PendingTextures.try_emplace(key, request);
+        if (!inserted)
+        {
+            return ResourceHandle<Texture>(pending->second);
+        }
+    }
+
+    std::cout << "[ResourceManager] Loading texture (async): " << key << std::endl;
+
+    // t@Cǂݍ݁EfR[h̓[J[
+    THREAD_POOL.Submit([this, filepath, format, key, request]()
+    {
+        auto texture = std::make_shared<Texture>();
+        if (!texture->Decode(filepath, format))
+        {
+            texture = nullptr;
+        }
+
+        // GPU]̓CXbh
+        EnqueueUpload([this, key, request, texture]()
+        {
+            bool uploaded = texture && texture->Upload();
+
+            std::shared_ptr<Texture> result;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (uploaded)
+                {
+                    result = AddCached(m_TextureCache, key, texture, texture->GetCpuBytes(), texture->GetGpuBytes());
+                }
+                m_PendingTextures.erase(key);
+            }
+            if (!result)
+            {
+                std::cerr << "[ResourceManager] Failed to load texture: " << key << std::endl;
+            }
+            request->Complete(result);
+        });
+    });
+
+    return ResourceHandle<Texture>(request);
+}
+
+// ===================================================================
+// bV̔񓯊ǂݍ
+// ===================================================================
+ResourceHandle<StaticMesh> ResourceManager::LoadMeshAsync(const std::string& filepath,
+    const std::string& textureDir)
+{
+    auto request = std::make_shared<ResourceRequest<StaticMesh>>();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // ǂݍݍς
+        if (auto mesh = FindCached(m_MeshCache, filepath))
+        {
+            return ResourceHandle<StaticMesh>::FromResource(mesh);
+        }
+
+        // ǂݍݒ  vL
+        auto [pending, inserted] = m_PendingMeshes.try_emplace(filepath, request);
+        if (!inserted)
+        {
+            return ResourceHandle<StaticMesh>(pending->second);
+        }
+    }
+
+    // ǂݍ (Assimp) ̓[J[
+    THREAD_POOL.Submit([this, filepath, textureDir, request]()
+    {
+        auto mesh = ImportMesh(filepath, textureDir);
+
+        // GPU]ELbVo^̓CXbh
+        EnqueueUpload([this, filepath, request, mesh]()
+        {
+            auto result = UploadMesh(filepath, mesh);
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_PendingMeshes.erase(filepath);
+            }
+            request->Complete(result);
+        });
+    });
+
+    return ResourceHandle<StaticMesh>(request);
+}
+
+// ===================================================================
+// GPU]҂̏s (CXbh)
+// ===================================================================
+void ResourceManager::ProcessUploads(double budgetMs)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        std::function<void()> upload;
+        {
+            std::lock_guard<std::mutex> lock(m_UploadMutex);
+            if (m_UploadQueue.empty()) return;
+            upload = std::move(m_UploadQueue.front());
+            m_UploadQueue.pop_front();
+        }
+        upload();
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) return;
+    }
+}
+
+// ===================================================================
+// GPU]CXbhɉ ([J[Xbh)
+// ===================================================================
+void ResourceManager::EnqueueUpload(std::function<void()> upload)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_UploadMutex);
+        m_UploadQueue.push_back(std::move(upload));
+    }
+    m_UploadCondition.notify_all();
+}
+
+// ===================================================================
+// 𖞂܂GPU]s (CXbh)
+// ===================================================================
+void ResourceManager::WaitUntil(const std::function<bool()>& isDone)
+{
+    // v̂̓CXbh̓]Ȃ̂ŁA
+    // ]҂܂ŖAs
+    while (!isDone())
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_UploadMutex);
+            m_UploadCondition.wait(lock, [this]() { return !m_UploadQueue.empty(); });
+        }
+        ProcessUploads(std::numeric_limits<double>::infinity());
+    }
+}
+
 // ===================================================================
 // VF[_[ǂݍ (LbVp)
 // ===================================================================
 std::shared_ptr<Shader> ResourceManager::LoadShader(const std::string& vsPath,
-    const std::string& psPath)
+    const std::string& psPath, EVertexFormat format)
 {
     // L[𐶐
-    std::string key = MakeShaderKey(vsPath, psPath);
+    std::string key = MakeShaderKey(vsPath, psPath, format);
 
     // LbVɑ݂邩mF
-    auto it = m_ShaderCache.find(key);
-    if (it != m_ShaderCache.end())
     {
-        std::cout << "[ResourceManager] Shader cache hit: " << key << std::endl;
-        return it->second;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (auto shader = FindCached(m_ShaderCache, key))
+        {
+            std::cout << "[ResourceManager] Shader cache hit: " << key << std::endl;
+            return shader;
+        }
     }
 
     // VKǂݍ
     std::cout << "[ResourceManager] Loading shader: " << key << std::endl;
     auto shader = std::make_shared<Shader>();
 
-    shader->Create(vsPath, psPath);
+    shader->Create(vsPath, psPath, format);
 
-    // LbVɕۑ
-    m_ShaderCache[key] = shader;
-    return shader;
+    // LbVɕۑ (VF[_[IuWFNg̓hCoɂ̂ŁAoCgR[h̑傫 GPU ƂĐ)
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return AddCached(m_ShaderCache, key, shader, 0, shader->GetBytecodeSize());
+}
+
+// ===================================================================
+// \Z̐ݒ
+// ===================================================================
+void ResourceManager::SetMemoryBudget(size_t cpuBytes, size_t gpuBytes)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_CpuBudget = cpuBytes;
+    m_GpuBudget = gpuBytes;
+    EvictUnused();
+}
+
+// ===================================================================
+// \Z𒴂ĂΎQƂĂȂ̂̂Ă
+// ===================================================================
+void ResourceManager::Trim()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    EvictUnused();
+}
+
+// ===================================================================
+// \Z𒴂Ă邩 (O)
+// ===================================================================
+bool ResourceManager::IsOverMemoryBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return IsOverBudget();
 }
 
 // ===================================================================
@@ -118,9 +360,12 @@ void ResourceManager::ClearAll()
 {
     std::cout << "[ResourceManager] Clearing all caches..." << std::endl;
 
+    std::lock_guard<std::mutex> lock(m_Mutex);
     m_TextureCache.clear();
     m_MeshCache.clear();
     m_ShaderCache.clear();
+    m_CpuBytes = 0;
+    m_GpuBytes = 0;
 
     std::cout << "[ResourceManager] All caches cleared" << std::endl;
 }
@@ -130,17 +375,176 @@ void ResourceManager::ClearAll()
 // ===================================================================
 void ResourceManager::PrintCacheInfo()
 {
+    ResourceCacheStats stats = GetCacheStats();
+
+    auto toMB = [](size_t bytes) { return bytes / (1024.0 * 1024.0); };
+    auto printUsage = [&](const char* label, const ResourceCacheUsage& usage)
+    {
+        std::cout << label << usage.count << " (" << usage.unused << " unused)"
+            << "  CPU " << toMB(usage.cpuBytes) << " MB"
+            << "  GPU " << toMB(usage.gpuBytes) << " MB" << std::endl;
+    };
+
     std::cout << "===== Resource Manager Cache Info =====" << std::endl;
-    std::cout << "Textures: " << m_TextureCache.size() << std::endl;
-    std::cout << "Meshes:   " << m_MeshCache.size() << std::endl;
-    std::cout << "Shaders:  " << m_ShaderCache.size() << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    printUsage("Textures: ", stats.textures);
+    printUsage("Meshes:   ", stats.meshes);
+    printUsage("Shaders:  ", stats.shaders);
+    std::cout << "Budget:   CPU " << toMB(stats.cpuBudget) << " MB  GPU " << toMB(stats.gpuBudget)
+        << " MB (0 = unlimited), " << stats.evicted << " evicted" << std::endl;
+    std::cout << "Pending:  " << stats.pendingTextures << " textures, "
+        << stats.pendingMeshes << " meshes" << std::endl;
     std::cout << "========================================" << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+// ===================================================================
+// LbV̎gpʂWv
+// ===================================================================
+ResourceCacheStats ResourceManager::GetCacheStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto measure = [](const auto& cache)
+    {
+        ResourceCacheUsage usage;
+        for (const auto& [key, entry] : cache)
+        {
+            usage.count++;
+            if (entry.resource.use_count() == 1) usage.unused++;
+            usage.cpuBytes += entry.cpuBytes;
+            usage.gpuBytes += entry.gpuBytes;
+        }
+        return usage;
+    };
+
+    ResourceCacheStats stats;
+    stats.textures = measure(m_TextureCache);
+    stats.meshes = measure(m_MeshCache);
+    stats.shaders = measure(m_ShaderCache);
+    stats.cpuBudget = m_CpuBudget;
+    stats.gpuBudget = m_GpuBudget;
+    stats.evicted = m_EvictedCount;
+    stats.pendingTextures = m_PendingTextures.size();
+    stats.pendingMeshes = m_PendingMeshes.size();
+    return stats;
+}
+
+// ===================================================================
+// LbVT (ΎgpXV)
+// ===================================================================
+template<typename T>
+std::shared_ptr<T> ResourceManager::FindCached(Cache<T>& cache, const std::string& key)
+{
+    auto it = cache.find(key);
+    if (it == cache.end()) return nullptr;
+
+    it->second.lastUsed = ++m_UseClock;
+    return it->second.resource;
+}
+
+// ===================================================================
+// LbVɓo^ (ɓo^Ă΂Ԃ)
+// ===================================================================
+template<typename T>
+std::shared_ptr<T> ResourceManager::AddCached(Cache<T>& cache, const std::string& key,
+    std::shared_ptr<T> resource, size_t cpuBytes, size_t gpuBytes)
+{
+    auto [it, inserted] = cache.try_emplace(key);
+    CacheEntry<T>& entry = it->second;
+    entry.lastUsed = ++m_UseClock;
+    if (!inserted) return entry.resource;
+
+    entry.resource = std::move(resource);
+    entry.cpuBytes = cpuBytes;
+    entry.gpuBytes = gpuBytes;
+    m_CpuBytes += cpuBytes;
+    m_GpuBytes += gpuBytes;
+
+    // o^{lQƂĂ̂ŁAꎩ̂͒ǂoȂ
+    std::shared_ptr<T> result = entry.resource;
+    EvictUnused();
+    return result;
+}
+
+// ===================================================================
+// \Z𒴂Ă邩
+// ===================================================================
+bool ResourceManager::IsOverBudget() const
+{
+    return (m_CpuBudget != 0 && m_CpuBytes > m_CpuBudget) ||
+        (m_GpuBudget != 0 && m_GpuBytes > m_GpuBudget);
+}
+
+// ===================================================================
+// QƂĂȂ̂ÂɎ̂Ă (\ZɎ܂܂)
+// ===================================================================
+void ResourceManager::EvictUnused()
+{
+    if (!IsOverBudget())
+    {
+        m_OverBudgetWarned = false;
+        return;
+    }
+
+    // : LbVĂāÂĂƎgpʂ
+    struct Candidate
+    {
+        uint64_t lastUsed;
+        std::function<void()> evict;
+    };
+    std::vector<Candidate> candidates;
+
+    auto collect = [&](auto& cache)
+    {
+        for (auto it = cache.begin(); it != cache.end(); ++it)
+        {
+            auto& entry = it->second;
+            if (entry.resource.use_count() != 1 || entry.cpuBytes + entry.gpuBytes == 0) continue;
+
+            candidates.push_back({ entry.lastUsed, [this, &cache, it]()
+            {
+                m_CpuBytes -= it->second.cpuBytes;
+                m_GpuBytes -= it->second.gpuBytes;
+                std::cout << "[ResourceManager] Evicted: " << it->first << std::endl;
+                cache.erase(it);
+                m_EvictedCount++;
+            } });
+        }
+    };
+    collect(m_TextureCache);
+    collect(m_MeshCache);
+    collect(m_ShaderCache);
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.lastUsed < b.lastUsed; });
+
+    for (Candidate& candidate : candidates)
+    {
+        if (!IsOverBudget()) break;
+        candidate.evict();
+    }
+
+    // gp̂̂ŒĂ (t[Ă΂̂1񂾂m点)
+    if (IsOverBudget() && !m_OverBudgetWarned)
+    {
+        std::cerr << "[ResourceManager] Over memory budget: remaining resources are still in use" << std::endl;
+        m_OverBudgetWarned = true;
+    }
+}
+
+// ===================================================================
+// eNX`L[ (֐)
+// ===================================================================
+std::string ResourceManager::MakeTextureKey(const std::string& filepath, ETextureFormat format)
+{
+    return filepath + "|" + std::to_string(format);
 }
 
 // ===================================================================
 // VF[_[L[ (֐)
 // ===================================================================
-std::string ResourceManager::MakeShaderKey(const std::string& vs, const std::string& ps)
+std::string ResourceManager::MakeShaderKey(const std::string& vs, const std::string& ps, EVertexFormat format)
 {
-    return vs + "|" + ps;
+    return vs + "|" + ps + "|" + std::to_string(format);
 }
\ No newline at end of file
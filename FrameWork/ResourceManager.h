@@ -1,6 +1,14 @@
 #pragma once
 #include "singleton.h"
+#include "ResourceHandle.h"
+#include "renderer.h"
+#include "TextureFile.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <string>
 
@@ -9,13 +17,74 @@ class Texture;
 class StaticMesh;
 class Shader;
 
+// ===================================================================
+// LbV̎gp (PrintCacheInfoEfobO\p)
+// ===================================================================
+struct ResourceCacheUsage
+{
+    size_t count = 0;       // ڐ
+    size_t unused = 0;      // LbVȊOQƂĂȂ (ǂoΏ)
+    size_t cpuBytes = 0;
+    size_t gpuBytes = 0;
+};
+
+struct ResourceCacheStats
+{
+    ResourceCacheUsage textures;
+    ResourceCacheUsage meshes;
+    ResourceCacheUsage shaders;
+    size_t cpuBudget = 0;       // \Z (0 ͖)
+    size_t gpuBudget = 0;
+    size_t evicted = 0;         // ܂łɒǂo
+    size_t pendingTextures = 0; // 񓯊ǂݍݒ̐
+    size_t pendingMeshes = 0;
+};
+
 class ResourceManager
 {
+public:
+    // ̃\Z
+    static constexpr size_t DefaultCpuBudget = size_t(256) << 20;  // 256MB
+    static constexpr size_t DefaultGpuBudget = size_t(512) << 20;  // 512MB
+
 private:
+    // LbV1
+    template<typename T>
+    struct CacheEntry
+    {
+        std::shared_ptr<T> resource;
+        size_t cpuBytes = 0;        // o^ɑgp
+        size_t gpuBytes = 0;
+        uint64_t lastUsed = 0;      // ŌɎgꂽ (m_UseClock ̒l)
+    };
+    template<typename T>
+    using Cache = std::unordered_map<std::string, CacheEntry<T>>;
+
     // LbV}bv (pXL[ shared_ptr ŊǗ)
-    std::unordered_map<std::string, std::shared_ptr<Texture>> m_TextureCache;
-    std::unordered_map<std::string, std::shared_ptr<StaticMesh>> m_MeshCache;
-    std::unordered_map<std::string, std::shared_ptr<Shader>> m_ShaderCache;
+    Cache<Texture> m_TextureCache;
+    Cache<StaticMesh> m_MeshCache;
+    Cache<Shader> m_ShaderCache;
+
+    // \ZƎgp (\Z𒴂QƂĂȂ̂Âɒǂo)
+    size_t m_CpuBudget = DefaultCpuBudget;
+    size_t m_GpuBudget = DefaultGpuBudget;
+    size_t m_CpuBytes = 0;
+    size_t m_GpuBytes = 0;
+    uint64_t m_UseClock = 0;
+    size_t m_EvictedCount = 0;
+    bool m_OverBudgetWarned = false;
+
+    // 񓯊ǂݍݒ̗v (pX̗v܂Ƃ߂)
+    std::unordered_map<std::string, std::shared_ptr<ResourceRequest<Texture>>> m_PendingTextures;
+    std::unordered_map<std::string, std::shared_ptr<ResourceRequest<StaticMesh>>> m_PendingMeshes;
+
+    // LbVEǂݍݒ̗v̕ی ([J[Xbh ImportMesh p)
+    mutable std::mutex m_Mutex;
+
+    // GPU]҂̏ ([J[ς݁ACXbh ProcessUploads Ŏs)
+    std::deque<std::function<void()>> m_UploadQueue;
+    std::mutex m_UploadMutex;
+    std::condition_variable m_UploadCondition;
 
 public:
     void Init();
@@ -23,8 +92,10 @@ public:
 
     // ===================================================================
     // eNX`ǂݍ (LbVp)
+    // format: TF_AUTO ̓~bvEubNkς݂ɕϊ (fp)
+    //         tHgEUI ̃AgX TF_RGBA8 (ϊ RGBA 1~bv) w肷
     // ===================================================================
-    std::shared_ptr<Texture> LoadTexture(const std::string& filepath);
+    std::shared_ptr<Texture> LoadTexture(const std::string& filepath, ETextureFormat format = TF_AUTO);
 
     // ===================================================================
     // bVǂݍ (LbVp)
@@ -32,11 +103,58 @@ public:
     std::shared_ptr<StaticMesh> LoadMesh(const std::string& filepath,
         const std::string& textureDir = "");
 
+    // ===================================================================
+    // bVǂݍ݂̕ (񓯊ǂݍݗp)
+    // ===================================================================
+
+    // CPU̓ǂݍ݂̂ ([J[XbhĂł悢BLbVς݂Ȃ炻Ԃ)
+    std::shared_ptr<StaticMesh> ImportMesh(const std::string& filepath,
+        const std::string& textureDir = "");
+
+    // ImportMesh ̌ʂGPUɓ]ăLbVɓo^ (CXbhŌĂ)
+    // ɓpXo^Ă΂Ԃ
+    std::shared_ptr<StaticMesh> UploadMesh(const std::string& filepath,
+        std::shared_ptr<StaticMesh> mesh);
+
+    // ===================================================================
+    // 񓯊ǂݍ (LbVp)
+    // t@Cǂݍ݁EfR[h̓[J[AGPU]CXbhōs
+    // pXǂݍݒɍēxvꍇ͓vL
+    // ===================================================================
+    ResourceHandle<Texture> LoadTextureAsync(const std::string& filepath, ETextureFormat format = TF_AUTO);
+    ResourceHandle<StaticMesh> LoadMeshAsync(const std::string& filepath,
+        const std::string& textureDir = "");
+
+    // GPU]҂̏s (CXbhŖt[Ă)
+    // budgetMs 𒴂c͎̃t[ɉ (Œ1͎s)
+    void ProcessUploads(double budgetMs = 2.0);
+
+    // ܂ő҂ (CXbhpB҂ĂԂGPU]i߂)
+    template<typename T>
+    std::shared_ptr<T> Wait(const ResourceHandle<T>& handle)
+    {
+        WaitUntil([&handle]() { return handle.IsDone(); });
+        return handle.Get();
+    }
+
     // ===================================================================
     // VF[_[ǂݍ (LbVp)
+    // format ͒_VF[_[󂯎钸_̌` (StaticMesh  VF_PACKED)
     // ===================================================================
     std::shared_ptr<Shader> LoadShader(const std::string& vsPath,
-        const std::string& psPath);
+        const std::string& psPath, EVertexFormat format = VF_3D);
+
+    // ===================================================================
+    // \Z
+    // ===================================================================
+
+    // \Zݒ肷 (0 ͖BĂ΂ɒǂo)
+    void SetMemoryBudget(size_t cpuBytes, size_t gpuBytes);
+    // \Z𒴂Ă΁ALbVȊOQƂĂȂ̂ÂɎ̂Ă
+    // (Vo^ɂsBV[؂ւɉꂽ̂͂Ŏ̂Ă)
+    void Trim();
+    // \Z𒴂Ă邩 (QƒŎ̂ĂȂ̂ŒĂꍇ true)
+    bool IsOverMemoryBudget() const;
 
     // ===================================================================
     // S\[X
@@ -47,10 +165,27 @@ public:
     // fobO
     // ===================================================================
     void PrintCacheInfo();
+    ResourceCacheStats GetCacheStats() const;
 
 private:
-    // VF[_[L[𐶐 ("vs_path|ps_path" ̌`)
-    std::string MakeShaderKey(const std::string& vs, const std::string& ps);
+    // eNX`L[𐶐 ("path|format" ̌`)
+    std::string MakeTextureKey(const std::string& filepath, ETextureFormat format);
+    // VF[_[L[𐶐 ("vs_path|ps_path|format" ̌`)
+    std::string MakeShaderKey(const std::string& vs, const std::string& ps, EVertexFormat format);
+
+    // GPU]CXbhɉ ([J[XbhĂ)
+    void EnqueueUpload(std::function<void()> upload);
+    // 𖞂܂GPU]s
+    void WaitUntil(const std::function<bool()>& isDone);
+
+    // LbV (m_Mutex ԂŌĂ)
+    template<typename T>
+    std::shared_ptr<T> FindCached(Cache<T>& cache, const std::string& key);
+    template<typename T>
+    std::shared_ptr<T> AddCached(Cache<T>& cache, const std::string& key,
+        std::shared_ptr<T> resource, size_t cpuBytes, size_t gpuBytes);
+    bool IsOverBudget() const;
+    void EvictUnused();
 };
 
 // BCX^X擾}N
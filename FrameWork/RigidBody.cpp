@@ -39,7 +39,7 @@ void Rigidbody::Update()
     if (m_IsKinematic) return;
 
     // f^^C擾
-    float deltaTime = Game::GetDeltaTime();
+    float deltaTime = GetDeltaTime();
 
     // ͂𓝍  xXV
     IntegrateForces(deltaTime);
@@ -60,6 +60,18 @@ void Rigidbody::Uninit()
     // ɏȂ
 }
 
+// ===================================================================
+// ėp̏ (Ỏ^zȂ)
+// ===================================================================
+void Rigidbody::OnReuse()
+{
+    m_Velocity = Vector3::Zero;
+    m_Acceleration = Vector3::Zero;
+    m_Force = Vector3::Zero;
+    m_AngularVelocity = Vector3::Zero;
+    m_Torque = Vector3::Zero;
+}
+
 // ===================================================================
 // ͂
 // ===================================================================
@@ -28,12 +28,28 @@ public:
     // ===================================================================
     Rigidbody();
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    // xȂǂ̎s̏Ԃ͕ۑȂ
+    static constexpr const char* TypeName = "Rigidbody";
+    static constexpr auto ReflectFields()
+    {
+        return std::make_tuple(
+            MakeField("Mass", &Rigidbody::m_Mass),
+            MakeField("Drag", &Rigidbody::m_Drag),
+            MakeField("AngularDrag", &Rigidbody::m_AngularDrag),
+            MakeField("UseGravity", &Rigidbody::m_UseGravity),
+            MakeField("IsKinematic", &Rigidbody::m_IsKinematic));
+    }
+
     // ===================================================================
     // Component C^[tF[X
     // ===================================================================
     void Init() override;
     void Update() override;
     void Uninit() override;
+    void OnReuse() override;
 
     // ===================================================================
     // ͂̑
@@ -19,6 +19,18 @@ public:
     RotatorComponent(const DirectX::SimpleMath::Vector3& rotationSpeed = DirectX::SimpleMath::Vector3(0, 1, 0))
         : m_RotationSpeed(rotationSpeed)
     {
+        // ڂ̉]Ȃ̂ŁAɂ鎞͊ԈčXV
+        SetUpdateRate(UpdateRate::DistanceBased);
+    }
+
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    static constexpr const char* TypeName = "RotatorComponent";
+    static constexpr auto ReflectFields()
+    {
+        return std::make_tuple(
+            MakeField("RotationSpeed", &RotatorComponent::m_RotationSpeed));
     }
 
     // ===================================================================
@@ -29,16 +41,14 @@ public:
         if (!m_pOwner) return;
 
         // f^^C擾
-        float deltaTime = Game::GetDeltaTime();
-
-        // ݂̉]擾
-        DirectX::SimpleMath::Vector3 rotation = m_pOwner->GetTransform().GetRotation();
+        float deltaTime = GetDeltaTime();
 
-        // ]Z
-        rotation += m_RotationSpeed * deltaTime;
+        // t[̉]
+        DirectX::SimpleMath::Vector3 delta = m_RotationSpeed * deltaTime;
 
-        // ]ݒ
-        m_pOwner->GetTransform().SetRotation(rotation);
+        // NH[^jIŉ]Z (Eulerp̉ZƈႢWobNȂ)
+        m_pOwner->GetTransform().Rotate(
+            DirectX::SimpleMath::Quaternion::CreateFromYawPitchRoll(delta.y, delta.x, delta.z));
     }
 
     // ===================================================================
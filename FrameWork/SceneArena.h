@@ -0,0 +1,268 @@
+// ===================================================================
+// SceneArena.h
+// V[Pʂ̃A[i
+// GameObjectER|[lg^Ƃ̃v[܂Ƃ߂ĊmۂA
+// V[Iɂ܂Ƃ߂ĉ
+// ===================================================================
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "SystemCommon.h"
+
+// ===================================================================
+// PoolBase
+// ^킸v[֕ԋp邽߂̊
+// ===================================================================
+class PoolBase
+{
+public:
+	virtual ~PoolBase() = default;
+
+	// ̈v[֕Ԃ (fXgN^͌Ăяoōς܂Ă)
+	virtual void Free(void* block) = 0;
+	// gp̌
+	virtual size_t GetLiveCount() const = 0;
+	// mۍς݂̗̈Sĉ
+	virtual void Release() = 0;
+	// mۍς݂̗̈̑傫 (oCg)
+	virtual size_t GetReservedBytes() const = 0;
+};
+
+// ===================================================================
+// PoolDeleter
+// v[mۂIuWFNgj unique_ptr pf[^
+// v[ȊO (new) Ŋmۂꂽ̂͒ʏ delete Ŕj
+// ===================================================================
+struct PoolDeleter
+{
+	PoolBase* pool = nullptr;	// mی̃v[ (nullptrȂ new Ŋm)
+	void* block = nullptr;		// mۂ̈̐擪 (NX̃|C^Ƃꍇ邽ߕێ)
+
+	PoolDeleter() = default;
+	PoolDeleter(PoolBase* _pool, void* _block) : pool(_pool), block(_block) {}
+
+	// std::make_unique ōꂽ unique_ptr ̕ϊp
+	template<typename T>
+	PoolDeleter(const std::default_delete<T>&) {}
+
+	template<typename T>
+	void operator()(T* ptr) const
+	{
+		if (!ptr) return;
+
+		if (pool)
+		{
+			// zfXgN^ŔhNX܂ŔjĂ̈悾Ԃ
+			ptr->~T();
+			pool->Free(block);
+		}
+		else
+		{
+			delete ptr;
+		}
+	}
+};
+
+// v[Ή unique_ptr
+template<typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter>;
+
+// ===================================================================
+// TypedPool
+// ^̃IuWFNgÄ (`N) ɂ܂Ƃ߂Ċmۂ
+// ===================================================================
+template<typename T>
+class TypedPool : public PoolBase
+{
+private:
+	// 1vf̑傫 (󂫗̈ɂ͎̋󂫗̈ւ̃|C^)
+	static constexpr size_t Align = (std::max)(alignof(T), alignof(void*));
+	static constexpr size_t Stride = ((std::max)(sizeof(T), sizeof(void*)) + Align - 1) / Align * Align;
+
+	std::vector<std::byte*> m_Chunks;	// mۍς݃`N
+	size_t m_ChunkCapacity;				// 1`N̗vf
+	size_t m_Used = 0;					// Ō̃`NŎgpς݂̗vf
+	void* m_FreeList = nullptr;			// ԋpꂽ̈̃Xg
+	size_t m_LiveCount = 0;				// gp̌
+
+public:
+	explicit TypedPool(size_t chunkCapacity = 64)
+		: m_ChunkCapacity(chunkCapacity) {}
+
+	~TypedPool() override { Release(); }
+
+	TypedPool(const TypedPool&) = delete;
+	TypedPool& operator=(const TypedPool&) = delete;
+
+	// ===================================================================
+	// 
+	// ===================================================================
+	template<typename... Args>
+	PoolPtr<T> Create(Args&&... args)
+	{
+		void* block = Allocate();
+		m_LiveCount++;
+
+		T* ptr = nullptr;
+		try
+		{
+			ptr = ::new (block) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			Free(block);
+			throw;
+		}
+		return PoolPtr<T>(ptr, PoolDeleter(this, block));
+	}
+
+	// ===================================================================
+	// PoolBase
+	// ===================================================================
+	void Free(void* block) override
+	{
+		// 󂫃Xg̐擪Ɍq
+		*static_cast<void**>(block) = m_FreeList;
+		m_FreeList = block;
+		if (m_LiveCount > 0) m_LiveCount--;
+	}
+
+	size_t GetLiveCount() const override { return m_LiveCount; }
+
+	size_t GetReservedBytes() const override { return m_Chunks.size() * Stride * m_ChunkCapacity; }
+
+	void Release() override
+	{
+#ifdef _DEBUG
+		assert(m_LiveCount == 0);	// gp̃IuWFNgcĂ
+#endif	// _DEBUG
+		for (std::byte* chunk : m_Chunks)
+		{
+			::operator delete(chunk, std::align_val_t(Align));
+		}
+		m_Chunks.clear();
+		m_Used = 0;
+		m_FreeList = nullptr;
+		m_LiveCount = 0;
+	}
+
+private:
+	void* Allocate()
+	{
+		// ԋpς݂̗̈悪΍ėp
+		if (m_FreeList)
+		{
+			void* block = m_FreeList;
+			m_FreeList = *static_cast<void**>(block);
+			return block;
+		}
+
+		// `NtȂV`Nm
+		if (m_Chunks.empty() || m_Used == m_ChunkCapacity)
+		{
+			m_Chunks.push_back(static_cast<std::byte*>(
+				::operator new(Stride * m_ChunkCapacity, std::align_val_t(Align))));
+			m_Used = 0;
+		}
+
+		// `N̐擪珇ɋl߂Ďg (^Aĕ)
+		return m_Chunks.back() + Stride * m_Used++;
+	}
+};
+
+// ===================================================================
+// SceneArena
+// ^Ƃ TypedPool ܂Ƃ߂ĎBV[1ێ
+// ===================================================================
+class SceneArena
+{
+private:
+	std::vector<std::unique_ptr<PoolBase>> m_Pools;	// ^ԍ  v[
+
+	// ^ƂɘAԂU
+	static size_t NextTypeIndex()
+	{
+		static size_t counter = 0;
+		return counter++;
+	}
+	template<typename T>
+	static size_t TypeIndex()
+	{
+		static const size_t index = NextTypeIndex();
+		return index;
+	}
+
+public:
+	SceneArena() = default;
+	~SceneArena() { Release(); }
+
+	SceneArena(const SceneArena&) = delete;
+	SceneArena& operator=(const SceneArena&) = delete;
+
+	// ===================================================================
+	// 
+	// ===================================================================
+	template<typename T, typename... Args>
+	PoolPtr<T> Create(Args&&... args)
+	{
+		return GetPool<T>().Create(std::forward<Args>(args)...);
+	}
+
+	// ^Ƃ̃v[擾 (ɍ쐬)
+	template<typename T>
+	TypedPool<T>& GetPool()
+	{
+		size_t index = TypeIndex<T>();
+		if (index >= m_Pools.size())
+		{
+			m_Pools.resize(index + 1);
+		}
+		if (!m_Pools[index])
+		{
+			m_Pools[index] = std::make_unique<TypedPool<T>>();
+		}
+		return *static_cast<TypedPool<T>*>(m_Pools[index].get());
+	}
+
+	// ===================================================================
+	// 
+	// ===================================================================
+
+	// Sv[̃`N܂Ƃ߂ĉ
+	// (GameObjectER|[lgSĔjɌĂԂ)
+	void Release()
+	{
+		for (auto& pool : m_Pools)
+		{
+			if (pool) pool->Release();
+		}
+	}
+
+	// gp̃IuWFNg̑
+	size_t GetLiveCount() const
+	{
+		size_t count = 0;
+		for (auto& pool : m_Pools)
+		{
+			if (pool) count += pool->GetLiveCount();
+		}
+		return count;
+	}
+
+	// mۍς݂̗̈̍v (oCg)
+	size_t GetReservedBytes() const
+	{
+		size_t bytes = 0;
+		for (auto& pool : m_Pools)
+		{
+			if (pool) bytes += pool->GetReservedBytes();
+		}
+		return bytes;
+	}
+};
\ No newline at end of file
@@ -4,67 +4,372 @@
 
 #include "SceneBase.h"
 #include "ResourceManager.h"
+#include "ThreadPool.h"
+#include "Game.h"
+#include "ComponentCodec.h"
+
+#include <cstdint>
+#include <ranges>
+#include <unordered_set>
 
 // R|[lg
 #include "MeshComponentWrapper.h"
 
-void loadModel(GameObject* modelObject, const ObjectData& objectData);
+using MeshImportMap = std::unordered_map<std::string, ResourceHandle<StaticMesh>>;
+using ImportedMeshMap = std::unordered_map<std::string, std::shared_ptr<StaticMesh>>;
+
+void submitMeshImport(const StageFile& stageFile, size_t index, const ImportedMeshMap& imported, MeshImportMap& imports);
+template<typename Indices>
+void importStageMeshes(const StageFile& stageFile, const Indices& indices, ImportedMeshMap& imported);
+void loadModel(GameObject* modelObject, const std::string& fileName, std::shared_ptr<StaticMesh> loadedMesh);
+void readStageComponent(const ComponentCodec& codec, Component* component,
+	const StageFile& stageFile, const StageComponentRecord& record, const std::string& objectName);
 // ===================================================================
-// xmlt@CIuWFNg̃f[^擾ăXg쐬
+// Xe[Wt@CIuWFNg̃f[^擾ăXg쐬
 // ===================================================================
 void SceneBase::MakeObjectList(const char* _stage)
 {
-	XmlRW xml;
-	std::vector<ObjectData> objects;
+	std::shared_ptr<const StageFile> stageFile;
+	ImportedMeshMap importedMeshes;
 
-	int ret = xml.GetObjectData(_stage, objects);
-	assert(ret != -1);	// G[`FbN
+	if (m_Preload.state == PreloadState::Ready && m_Preload.stage == _stage)
+	{
+		// 񓯊ǂݍݍς݂̃f[^giXe[Wt@CEbVǂݍ݂ȗj
+		stageFile = std::move(m_Preload.stageFile);
+		importedMeshes = std::move(m_Preload.meshes);
+		std::cout << "[" << _stage << "] " << "Using preloaded stage data" << std::endl;
+	}
+	else
+	{
+		// xml ̕V΂ŃoCiɕϊ
+		stageFile = StageFile::Open(_stage);
+		assert(stageFile);	// G[`FbN
+	}
+	CancelPreload();
+	if (!stageFile) return;
 
-	int n = 0;
+	// ---- 1, 2. KvȃfW߂ă[J[ŕɓǂݍ݁A҂it@C1񂾂j
+	size_t count = stageFile->GetObjectCount();
+	importStageMeshes(*stageFile, std::views::iota(size_t(0), count), importedMeshes);
+
+	// ---- 3. GameObject쐬Aǂݍ񂾃bVLĊ蓖Ă
 	//@Sf[^R|[lgf[^ɕϊăXgɊi[
-	for (ObjectData object : objects)
+	// (}bvz𒼐ړǂށB͕KvȂ̂)
+	for (size_t n = 0; n < count; n++)
 	{
-		// gXtH[f[^n
-		auto obj = std::make_unique<GameObject>(Vector3(object.pos), Vector3(object.rot), Vector3(object.scl));
-		GameObject* newObject = obj.get();
-		newObject->SetID(n);
-		newObject->SetName(object.objectName);
-		newObject->SetTag(object.objectTag);
+		CreateStageObject(*stageFile, n, importedMeshes);
+
+		// 쐬bZ[W
+		std::cout << "[" << _stage << "] " << stageFile->GetName(n) << " created" << std::endl;
+	}
+}
 
-		if (typeTags.contains(object.objectType))
+// ===================================================================
+// Xe[Wt@C1IuWFNgGameObject쐬ăXgɒǉ
+// ===================================================================
+GameObject* SceneBase::CreateStageObject(const StageFile& stageFile, size_t index,
+	std::unordered_map<std::string, std::shared_ptr<StaticMesh>>& importedMeshes)
+{
+	const StageTransform& transform = stageFile.GetTransform(index);
+	const StageColor& color = stageFile.GetColor(index);
+
+	// gXtH[f[^n
+	// A[imہiR|[lgA[ǐ^ʃv[mۂj
+	auto obj = m_Arena.Create<GameObject>(Vector3(transform.pos), Vector3(transform.rot), Vector3(transform.scl));
+	GameObject* newObject = obj.get();
+	newObject->SetArena(&m_Arena);
+	newObject->SetID(static_cast<int>(index));
+	newObject->SetName(std::string(stageFile.GetName(index)));
+	newObject->SetTag(std::string(stageFile.GetTag(index)));
+	m_Registry.Register(newObject);
+
+	switch (stageFile.GetType(index))
+	{
+	// L[u`R|[lgiWORLDwj
+	case StageObjectType::SimpleCube:
+		newObject->AddMeshComponent<SimpleCubeRendererComponent>(Vector4(color.rgba));
+		break;
+	// ʕ`R|[lgiWORLDwj
+	case StageObjectType::SimplePlane:
+		newObject->AddMeshComponent<SimplePlaneRendererComponent>(Vector4(color.rgba));
+		break;
+	// fR|[lgiWORLDwj
+	case StageObjectType::Model:
+	{
+		std::string fileName(stageFile.GetFileName(index));
+		std::string texture(stageFile.GetTexture(index));
+		newObject->AddMeshComponent<MeshRendererComponent>(fileName, texture);
+		loadModel(newObject, fileName, importedMeshes[fileName]);
+		break;
+	}
+	default:
+		break;
+	}
+
+	// `ȊÕR|[lgi^Ƃ̕ϊ\ŒǉĒlǂށj
+	ComponentLoadContext context{ &m_Camera };
+	for (const StageComponentRecord& record : stageFile.GetComponents(index))
+	{
+		const ComponentCodec* codec = FindComponentCodec(stageFile.GetString(record.type));
+		if (!codec)
 		{
-			auto tag = typeTags[object.objectType];
+			std::cerr << "[StageFile] " << newObject->GetName() << ": unknown component "
+				<< stageFile.GetString(record.type) << std::endl;
+			continue;
+		}
+		readStageComponent(*codec, codec->add(newObject, context), stageFile, record, newObject->GetName());
+	}
 
-			// L[u`R|[lgiWORLDwj
-			if (tag == &tag_cube)
-			{
-				newObject->AddMeshComponent<SimpleCubeRendererComponent>(Vector4(object.color));
-			}
-			// ʕ`R|[lgiWORLDwj
-			else if (tag == &tag_plane)
-			{
-				newObject->AddMeshComponent<SimplePlaneRendererComponent>(Vector4(object.color));
-			}
-			// fR|[lgiWORLDwj
-			else if (tag == &tag_model)
-			{
-				newObject->AddMeshComponent<MeshRendererComponent>(object.fileName, object.texture);
-				std::cout << "[" << _stage << "] " << "Attempting to load model : " << object.fileName << std::endl;
-				loadModel(newObject, object);
-				std::cout << "[" << _stage << "] " << "OBJ Model loaded successfully!" << std::endl;
-			}
+	m_GameObjects.push_back(std::move(obj));
+	return newObject;
+}
+
+// ===================================================================
+// Xe[Wt@C̕ύXf
+// ===================================================================
+void SceneBase::ApplyStageDiff(const char* _stage)
+{
+	// xml ̕V̂łŃoCiɕϊ
+	auto stageFile = StageFile::Open(_stage);
+	if (!stageFile)
+	{
+		std::cerr << "[" << _stage << "] " << "Hot reload failed: stage file could not be read" << std::endl;
+		return;
+	}
+
+	// O  Xe[W̔ԍiΏoĂ鏇ɕׁÂ̂ƏԂɑΉj
+	struct StageIndexList
+	{
+		std::vector<size_t> indices;
+		size_t next = 0;	// ɑΉʒu
+	};
+	size_t count = stageFile->GetObjectCount();
+	std::unordered_map<std::string_view, StageIndexList> stageIndex;
+	stageIndex.reserve(count);
+	for (size_t n = 0; n < count; n++)
+	{
+		stageIndex[stageFile->GetName(n)].indices.push_back(n);
+	}
+
+	// ---- 1. GameObject𖼑Oŏƍ
+	// ށEfς͍̂蒼AȊO͒l
+	std::vector<GameObject*> matched(count, nullptr);
+	std::vector<GameObject*> removed;
+	size_t updated = 0;
+
+	for (auto& obj : m_GameObjects)
+	{
+		GameObject* object = obj.get();
+
+		// Prefab琶̂̓Xe[Wf[^Ɋ܂܂Ȃ
+		if (object->GetPrefabId() >= 0) continue;
+
+		auto it = stageIndex.find(object->GetName());
+		if (it == stageIndex.end() || it->second.next >= it->second.indices.size())
+		{
+			removed.push_back(object);
+			continue;
+		}
+
+		size_t n = it->second.indices[it->second.next++];
+		if (!MatchesStageShape(object, *stageFile, n))
+		{
+			removed.push_back(object);
+			continue;
 		}
 
-		m_GameObjects.push_back(std::move(obj));
+		matched[n] = object;
+		if (ApplyStageValues(object, *stageFile, n)) updated++;
+	}
 
-		// 쐬bZ[W
-		std::cout << "[" << _stage << "] " << object.objectName << " created" << std::endl;
+	// ---- 2. Ȃ́E蒼̂폜iXg̍폜1ɂ܂Ƃ߂j
+	if (!removed.empty())
+	{
+		std::unordered_set<GameObject*> removedSet(removed.begin(), removed.end());
+		for (GameObject* object : removed)
+		{
+			DetachGameObject(object);
+		}
+		std::erase_if(m_GameObjects, [&removedSet](const PoolPtr<GameObject>& obj) {
+			return removedSet.contains(obj.get());
+		});
+	}
+
+	// ---- 3. ǉꂽ́E蒼̂쐬iǂݍݍς݂̃bV̓LbV狤Lj
+	std::vector<size_t> added;
+	for (size_t n = 0; n < count; n++)
+	{
+		if (!matched[n]) added.push_back(n);
+	}
+
+	ImportedMeshMap importedMeshes;
+	importStageMeshes(*stageFile, added, importedMeshes);
+	for (size_t n : added)
+	{
+		matched[n] = CreateStageObject(*stageFile, n, importedMeshes);
+	}
+
+	// ---- 4. XgXe[W̏ɕגĔԍU蒼iPrefab̃CX^X͖j
+	std::unordered_map<GameObject*, size_t> order;
+	order.reserve(count);
+	for (size_t n = 0; n < count; n++)
+	{
+		order.emplace(matched[n], n);
+		matched[n]->SetID(static_cast<int>(n));
+	}
+	std::stable_sort(m_GameObjects.begin(), m_GameObjects.end(),
+		[&order](const PoolPtr<GameObject>& a, const PoolPtr<GameObject>& b) {
+			auto ia = order.find(a.get());
+			auto ib = order.find(b.get());
+			size_t ka = ia != order.end() ? ia->second : SIZE_MAX;
+			size_t kb = ib != order.end() ? ib->second : SIZE_MAX;
+			return ka < kb;
+		});
+
+	std::cout << "[" << _stage << "] " << "Hot reloaded: " << updated << " updated, "
+		<< added.size() << " added, " << removed.size() << " removed" << std::endl;
+}
+
+// ===================================================================
+// GameObject̎ށEfER|[lg̑gݍ킹Xe[Wf[^ƈv邩
+// ===================================================================
+bool SceneBase::MatchesStageShape(GameObject* object, const StageFile& stageFile, size_t index)
+{
+	// ۑłR|[lg̑gݍ킹iR[hŒǉۑȂR|[lgׂ͔Ȃj
+	ComponentMask stageMask = 0;
+	for (const StageComponentRecord& record : stageFile.GetComponents(index))
+	{
+		if (const ComponentCodec* codec = FindComponentCodec(stageFile.GetString(record.type)))
+		{
+			stageMask |= codec->bit;
+		}
+	}
+	if ((object->GetComponentMask() & GetReflectedComponentMask()) != stageMask) return false;
+
+	auto* cube = object->GetMeshComponent<SimpleCubeRendererComponent>();
+	auto* plane = object->GetMeshComponent<SimplePlaneRendererComponent>();
+	auto* model = object->GetMeshComponent<MeshRendererComponent>();
+
+	switch (stageFile.GetType(index))
+	{
+	case StageObjectType::SimpleCube:
+		return cube && !plane && !model;
+	case StageObjectType::SimplePlane:
+		return plane && !cube && !model;
+	case StageObjectType::Model:
+		// ǂݍ݂Ɏsđ̃L[uɂȂĂ͍̂蒼iēǂݍ݂݂j
+		return model && !cube && !plane &&
+			model->GetModelPath() == stageFile.GetFileName(index) &&
+			model->GetTexturePath() == stageFile.GetTexture(index);
+	default:
+		return !cube && !plane && !model;
+	}
+}
+
+// ===================================================================
+// Xe[Wf[^̒ligXtH[EFE^OER|[lgj𔽉f
+// ===================================================================
+bool SceneBase::ApplyStageValues(GameObject* object, const StageFile& stageFile, size_t index)
+{
+	const StageTransform& transform = stageFile.GetTransform(index);
+	Color color(stageFile.GetColor(index).rgba);
+	bool changed = false;
+
+	// lς̂uiςĂȂΎs̒l͂̂܂܁j
+	changed |= object->GetTransform().SetInitialState(
+		Vector3(transform.pos), Vector3(transform.rot), Vector3(transform.scl));
+
+	if (auto* cube = object->GetMeshComponent<SimpleCubeRendererComponent>())
+	{
+		if (cube->GetColor() != color)
+		{
+			cube->SetColor(color);
+			changed = true;
+		}
+	}
+	if (auto* plane = object->GetMeshComponent<SimplePlaneRendererComponent>())
+	{
+		if (plane->GetColor() != color)
+		{
+			plane->SetColor(color);
+			changed = true;
+		}
+	}
+
+	if (object->GetTag() != stageFile.GetTag(index))
+	{
+		object->SetTag(std::string(stageFile.GetTag(index)));
+		changed = true;
+	}
+
+	// R|[lg̒liǂޑOŏoeׂj
+	ComponentData before, after;
+	for (const StageComponentRecord& record : stageFile.GetComponents(index))
+	{
+		const ComponentCodec* codec = FindComponentCodec(stageFile.GetString(record.type));
+		Component* component = codec ? codec->get(object) : nullptr;
+		if (!component) continue;
+
+		codec->write(component, before);
+		readStageComponent(*codec, component, stageFile, record, object->GetName());
+		codec->write(component, after);
+		changed |= before != after;
+	}
+	return changed;
+}
+
+// ===================================================================
+// Xe[Wf[^̃R|[lg̑𔽉f
+// ===================================================================
+void readStageComponent(const ComponentCodec& codec, Component* component,
+	const StageFile& stageFile, const StageComponentRecord& record, const std::string& objectName)
+{
+	for (const StageAttributeRecord& attribute : stageFile.GetAttributes(record))
+	{
+		if (!codec.readAttribute(component, stageFile.GetString(attribute.name), stageFile.GetString(attribute.value)))
+		{
+			std::cerr << "[StageFile] " << objectName << ": invalid attribute " << codec.typeName << "."
+				<< stageFile.GetString(attribute.name) << "=\"" << stageFile.GetString(attribute.value) << "\"" << std::endl;
+		}
+	}
+}
 
-		n++;
+// ===================================================================
+// Xe[W̃f̔񓯊ǂݍ݂Jn (t@CƂ1)
+// ===================================================================
+void submitMeshImport(const StageFile& stageFile, size_t index, const ImportedMeshMap& imported, MeshImportMap& imports)
+{
+	if (stageFile.GetType(index) != StageObjectType::Model) return;
+
+	std::string fileName(stageFile.GetFileName(index));
+	if (imported.contains(fileName) || imports.contains(fileName)) return;
+
+	// ǂݍ݂̓[J[AGPU]̓CXbhi̗vƓt@CȂ狤Lj
+	imports[fileName] = M_RESOURCE.LoadMeshAsync(fileName, std::string(stageFile.GetTexture(index)));
+}
+
+// ===================================================================
+// w肵IuWFNg̃fɓǂݍ݁A҂
+// (ŝ nullptr ̂܂ܓo^ACX^XƂɍēǂݍ݂Ȃ)
+// ===================================================================
+template<typename Indices>
+void importStageMeshes(const StageFile& stageFile, const Indices& indices, ImportedMeshMap& imported)
+{
+	MeshImportMap imports;
+	for (size_t index : indices)
+	{
+		submitMeshImport(stageFile, index, imported, imports);
+	}
+	for (auto& [fileName, import] : imports)
+	{
+		imported[fileName] = M_RESOURCE.Wait(import);
 	}
 }
 
-void loadModel(GameObject* modelObject, const ObjectData& objectData)
+// ===================================================================
+// ǂݍݍς݂̃bVfR|[lgɊ蓖Ă
+// ===================================================================
+void loadModel(GameObject* modelObject, const std::string& fileName, std::shared_ptr<StaticMesh> loadedMesh)
 {
 	bool modelLoaded = false;
 
@@ -77,15 +382,16 @@ void loadModel(GameObject* modelObject, const ObjectData& objectData)
 		auto* meshRenderer = modelObject->GetMeshComponent<MeshRendererComponent>();
 		meshRenderer->SetRenderLayer(RenderLayer::WORLD);
 
-		// bVǂݍ
-		auto mesh = M_RESOURCE.LoadMesh(objectData.fileName, objectData.texture);
+		// GPU]ELbVo^ LoadMeshAsync ōςł
+		auto mesh = loadedMesh;
 
 		if (mesh)
 		{
 			meshRenderer->SetMesh(mesh);
 
 			// VF[_[ݒ
-			auto shader = M_RESOURCE.LoadShader("shader/litTextureVS.hlsl", "shader/litTexturePS.hlsl");
+			// StaticMesh ̒_͈kς (VERTEX_PACKED)
+			auto shader = M_RESOURCE.LoadShader("shader/litTexturePackedVS.hlsl", "shader/litTexturePS.hlsl", VF_PACKED);
 			if (shader)
 			{
 				meshRenderer->SetShader(shader);
@@ -98,7 +404,7 @@ void loadModel(GameObject* modelObject, const ObjectData& objectData)
 #ifdef _DEBUG	
 			assert(mesh);	// fobÔ݃bVǂݍݎsɃG[o
 #endif	// _DEBUG
-			std::cerr << "[SceneResult] Model file not found or failed to load" << std::endl;
+			std::cerr << "[SceneResult] Model file not found or failed to load: " << fileName << std::endl;
 			modelObject->RemoveMeshComponent<MeshRendererComponent>();
 		}
 	}
@@ -124,17 +430,107 @@ void loadModel(GameObject* modelObject, const ObjectData& objectData)
 	}
 }
 
+// ===================================================================
+// Xe[Wf[^̔񓯊ǂݍ݂Jn
+// ===================================================================
+void SceneBase::BeginPreload(const std::string& stage)
+{
+	CancelPreload();
+
+	m_Preload.stage = stage;
+	m_Preload.state = PreloadState::Parsing;
+	m_Preload.parse = THREAD_POOL.Submit([stage]()
+	{
+		auto stageFile = StageFile::Open(stage);
+		if (!stageFile)
+		{
+			throw std::runtime_error("failed to read stage data: " + stage);
+		}
+		return stageFile;
+	});
+
+	std::cout << "[" << stage << "] " << "Preload started" << std::endl;
+}
+
+// ===================================================================
+// Xe[Wf[^̔񓯊ǂݍ݂i߂
+// ===================================================================
+bool SceneBase::UpdatePreload()
+{
+	// Xe[Wt@Cǂݍ݂̊҂
+	if (m_Preload.state == PreloadState::Parsing)
+	{
+		if (!IsFutureReady(m_Preload.parse)) return false;
+
+		try
+		{
+			m_Preload.stageFile = m_Preload.parse.get();
+		}
+		catch (const std::exception& e)
+		{
+			// s MakeObjectList ̓ǂݍ݂ɔC
+			std::cerr << "[" << m_Preload.stage << "] " << "Preload failed: " << e.what() << std::endl;
+			CancelPreload();
+			return true;
+		}
+
+		// ft@CƂ1ǂݍ݂𓊂
+		const StageFile& stageFile = *m_Preload.stageFile;
+		for (size_t i = 0; i < stageFile.GetObjectCount(); i++)
+		{
+			submitMeshImport(stageFile, i, m_Preload.meshes, m_Preload.imports);
+		}
+		m_Preload.state = PreloadState::Importing;
+	}
+
+	// bVǂݍ݂̊҂
+	if (m_Preload.state == PreloadState::Importing)
+	{
+		for (auto it = m_Preload.imports.begin(); it != m_Preload.imports.end();)
+		{
+			if (it->second.IsDone())
+			{
+				m_Preload.meshes[it->first] = it->second.Get();
+				it = m_Preload.imports.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		if (!m_Preload.imports.empty()) return false;
+
+		m_Preload.state = PreloadState::Ready;
+		std::cout << "[" << m_Preload.stage << "] " << "Preload finished" << std::endl;
+	}
+
+	return true;
+}
+
+// ===================================================================
+// Xe[Wf[^̔񓯊ǂݍ݂j
+// ===================================================================
+void SceneBase::CancelPreload()
+{
+	// s̃^XN͌ʂ̂Ă邾ifuture ̔jł͑҂Ȃj
+	m_Preload = StagePreload();
+}
+
 // ===================================================================
 // GameObjectXg폜
 // ===================================================================
 void SceneBase::SaveObjectData(const char* _stage)
 {
-	XmlRW xml;
+	// ۑe͂ŕAt@Cւ݂̏̓[J[ōs
 	std::vector<ObjectData> objects;
+	objects.reserve(m_GameObjects.size());
 
 	//@Sf[^R|[lgf[^ɕϊăXgɊi[
 	for (auto& gameObject : m_GameObjects)
 	{
+		// Prefab琶 (ҋ@܂) ̓Xe[Wf[^Ɋ܂߂Ȃ (ApplyStageDiff Ɠ)
+		if (gameObject->GetPrefabId() >= 0) continue;
+
 		ObjectData object;
 
 		object.id = gameObject->GetID();
@@ -147,17 +543,17 @@ void SceneBase::SaveObjectData(const char* _stage)
 		// ^Cv̓R|[lgŊmF
 		if (auto component = gameObject->GetMeshComponent<SimpleCubeRendererComponent>())
 		{
-			object.objectType = strSimpleCube;
+			object.objectType = GetStageObjectTypeName(StageObjectType::SimpleCube);
 			color = component->GetColor();
 		}
 		else if(auto component = gameObject->GetMeshComponent<SimplePlaneRendererComponent>())
 		{
-			object.objectType = strSimplePlane;
+			object.objectType = GetStageObjectTypeName(StageObjectType::SimplePlane);
 			color = component->GetColor();
 		}
 		else if (auto component = gameObject->GetMeshComponent<MeshRendererComponent>())
 		{
-			object.objectType = strModel;
+			object.objectType = GetStageObjectTypeName(StageObjectType::Model);
 			object.fileName = component->GetModelPath();	// ff[^㏑
 			object.texture = component->GetTexturePath();	// eNX`f[^㏑
 		}
@@ -175,13 +571,35 @@ void SceneBase::SaveObjectData(const char* _stage)
 		object.color[2] = color.z;
 		object.color[3] = color.w;
 
-		objects.push_back(object);
+		// `ȊÕR|[lgi^Ƃ̕ϊ\ŏoj
+		for (const ComponentCodec& codec : GetComponentCodecs())
+		{
+			if (gameObject->GetComponentMask() & codec.bit)
+			{
+				codec.write(codec.get(gameObject.get()), object.components.emplace_back());
+			}
+		}
+
+		objects.push_back(std::move(object));
 	}
 
-	xml.UpdateObjectsInXML(objects, _stage);
+	// O̕ۑI܂ő҂iÂeŏ㏑Ȃ悤Ɂj
+	if (m_SaveTask.valid())
+	{
+		m_SaveTask.wait();
+	}
+
+	std::string stage = _stage;
+	m_SaveTask = THREAD_POOL.Submit([objects = std::move(objects), stage]()
+	{
+		XmlRW xml;
+		int ret = xml.UpdateObjectsInXML(objects, stage.c_str());
 
-	// bZ[W
-	std::cout << "[" << _stage << "] saved complete" << std::endl;
+		// bZ[W
+		if (ret != -1) std::cout << "[" << stage << "] saved complete" << std::endl;
+		else std::cerr << "[" << stage << "] save failed" << std::endl;
+		return ret;
+	});
 }
 
 // ===================================================================
@@ -197,8 +615,353 @@ void SceneBase::DeleteObjectList()
 			obj->Uninit();
 		}
 	}
-	// XgNA
+	// f̗\j
+	m_Commands.Clear();
+	m_FlushingCommands.Clear();
+
+	// ƃXgNA
+	m_Registry.Clear();
+	m_SpatialIndex.Clear();
 	m_GameObjects.clear();
+	m_Prefabs.clear();
+	m_PrefabNames.clear();
+
+	// A[ĩ`N܂Ƃ߂ĉ
+	m_Arena.Release();
+
+	// ĵňꎞ~Ԃ
+	m_isSuspended = false;
+}
+
+// ===================================================================
+// 풓V[̈ꎞ~
+// ===================================================================
+void SceneBase::Suspend()
+{
+	// \ς݂̍\ύX͔fĂ~߂
+	FlushCommandBuffer();
+	CancelPreload();
+
+	// ĂPrefab̃CX^X (eEGtFNg) ͑ҋ@ɖ߂
+	// (Despawn̓XgύXȂ̂ŁÂ܂ܑĂ悢)
+	for (auto& obj : m_GameObjects)
+	{
+		if (obj->GetPrefabId() >= 0)
+		{
+			Despawn(obj.get());
+		}
+	}
+
+	for (auto& obj : m_GameObjects)
+	{
+		obj->OnSuspend();
+	}
+
+	m_isSuspended = true;
+	std::cout << "[SceneBase] Suspended (" << GetResidentBytes() / 1024 << " KB resident)" << std::endl;
+}
+
+// ===================================================================
+// 풓V[̍ĊJ
+// ===================================================================
+void SceneBase::Resume()
+{
+	for (auto& obj : m_GameObjects)
+	{
+		obj->OnResume();
+		// pER|[lg̏Ԃlɖ߂ (ҋ@Prefab̃CX^XSpawnɖ߂̂ŐGȂ)
+		if (!obj->IsInPool())
+		{
+			obj->OnReuse();
+		}
+	}
+
+	m_Camera.Init();
+	m_nextScene = 999;	// SCENE_NONE
+	m_isSuspended = false;
+	std::cout << "[SceneBase] Resumed" << std::endl;
+}
+
+// ===================================================================
+// 풓̃gpʂ̊TZ
+// ===================================================================
+size_t SceneBase::GetResidentBytes() const
+{
+	// V[Ă (A[i GameObjectER|[lgƁÄꗗ)
+	// bVEeNX` ResourceManager ̋LLbVɂAV[jĂȂ̂ŐȂ
+	size_t bytes = m_Arena.GetReservedBytes();
+	bytes += m_GameObjects.capacity() * sizeof(PoolPtr<GameObject>);
+	for (const PrefabPool& pool : m_Prefabs)
+	{
+		bytes += pool.inactive.capacity() * sizeof(GameObject*);
+	}
+	return bytes;
+}
+
+// ===================================================================
+// GameObjectXgɒǉ
+// ===================================================================
+GameObject* SceneBase::AddGameObject(PoolPtr<GameObject> object)
+{
+	if (!object) return nullptr;
+
+	GameObject* ptr = object.get();
+	m_Registry.Register(ptr);
+	m_GameObjects.push_back(std::move(object));
+	return ptr;
+}
+
+// ===================================================================
+// GameObjectXg폜
+// ===================================================================
+void SceneBase::RemoveGameObject(GameObject* object)
+{
+	if (!object) return;
+
+	DetachGameObject(object);
+
+	m_GameObjects.erase(
+		std::remove_if(m_GameObjects.begin(), m_GameObjects.end(),
+			[object](const PoolPtr<GameObject>& obj) {
+				return obj.get() == object;
+			}),
+		m_GameObjects.end()
+	);
+}
+
+// ===================================================================
+// GameObjectOďIĂԁiXg͊OȂj
+// ===================================================================
+void SceneBase::DetachGameObject(GameObject* object)
+{
+	// Prefab̑ҋ@XgɎcĂΊO
+	int prefabId = object->GetPrefabId();
+	if (prefabId >= 0 && prefabId < static_cast<int>(m_Prefabs.size()))
+	{
+		auto& inactive = m_Prefabs[prefabId].inactive;
+		inactive.erase(std::remove(inactive.begin(), inactive.end(), object), inactive.end());
+	}
+
+	// ɍOiÂnh͂ŖɂȂj
+	m_Registry.Unregister(object);
+	m_SpatialIndex.Remove(object->GetSpatialId());
+	object->SetSpatialId(-1);
+	object->Uninit();
+}
+
+// ===================================================================
+// \ύX̗\
+// ===================================================================
+void SceneBase::QueueDestroy(GameObject* object)
+{
+	if (!object) return;
+	m_Commands.destroys.push_back(object->GetHandle());
+}
+
+void SceneBase::QueueSpawn(int prefabId, const Vector3& position)
+{
+	m_Commands.spawns.push_back({ prefabId, position });
+}
+
+void SceneBase::QueueAddGameObject(PoolPtr<GameObject> object)
+{
+	if (!object) return;
+	m_Commands.additions.push_back(std::move(object));
+}
+
+// ===================================================================
+// \񂳂ꂽ\ύX܂Ƃ߂Ĕf
+// ===================================================================
+void SceneBase::FlushCommandBuffer()
+{
+	// fɐVȗ\񂪐ς܂Ă肱ڂȂ悤AɂȂ܂ŌJԂ
+	// (InitōXɐ铙̘A~܂Ȃꍇɔď݂)
+	const int maxPasses = 8;
+	for (int pass = 0; pass < maxPasses && !m_Commands.IsEmpty(); pass++)
+	{
+		std::swap(m_Commands, m_FlushingCommands);
+		SceneCommandBuffer& commands = m_FlushingCommands;
+
+		// @ 폜 (Prefab̃CX^X͑ҋ@ցAȊO͍OĂ܂Ƃ߂ď)
+		bool removed = false;
+		for (GameObjectHandle handle : commands.destroys)
+		{
+			GameObject* object = m_Registry.Resolve(handle);
+			if (!object) continue;	// ɍ폜ς
+
+			if (object->GetPrefabId() >= 0)
+			{
+				Despawn(object);
+				continue;
+			}
+
+			m_Registry.Unregister(object);
+			m_SpatialIndex.Remove(object->GetSpatialId());
+			object->SetSpatialId(-1);
+			object->Uninit();
+			removed = true;
+		}
+		if (removed)
+		{
+			// Oꂽ(nh)̂1̑Ŏ菜
+			m_GameObjects.erase(
+				std::remove_if(m_GameObjects.begin(), m_GameObjects.end(),
+					[](const PoolPtr<GameObject>& obj) {
+						return !obj || !obj->GetHandle().IsValid();
+					}),
+				m_GameObjects.end()
+			);
+		}
+
+		// A R|[lg̒ǉE폜 (Ώۂ폜ς݂Ȃ̂Ă)
+		for (auto& command : commands.componentCommands)
+		{
+			if (GameObject* object = m_Registry.Resolve(command.target))
+			{
+				command.apply(object);
+			}
+		}
+
+		// B ǉE
+		for (auto& object : commands.additions)
+		{
+			AddGameObject(std::move(object));
+		}
+		for (const auto& spawn : commands.spawns)
+		{
+			Spawn(spawn.prefabId, spawn.position);
+		}
+
+		commands.Clear();
+	}
+}
+
+// ===================================================================
+// Prefabo^
+// ===================================================================
+int SceneBase::RegisterPrefab(const Prefab& prefab)
+{
+	auto it = m_PrefabNames.find(prefab.name);
+	if (it != m_PrefabNames.end())
+	{
+		// Prefab̓ev[gւ (ς݂̃CX^X͂̂܂)
+		m_Prefabs[it->second].prefab = prefab;
+		return it->second;
+	}
+
+	int id = static_cast<int>(m_Prefabs.size());
+	m_Prefabs.push_back(PrefabPool{ prefab });
+	m_PrefabNames.emplace(prefab.name, id);
+	return id;
+}
+
+// ===================================================================
+// PrefabPrefabԍ擾
+// ===================================================================
+int SceneBase::FindPrefab(const std::string& name) const
+{
+	auto it = m_PrefabNames.find(name);
+	return it != m_PrefabNames.end() ? it->second : -1;
+}
+
+// ===================================================================
+// CX^XOɐ
+// ===================================================================
+void SceneBase::PrewarmPrefab(int prefabId, size_t count)
+{
+	if (prefabId < 0 || prefabId >= static_cast<int>(m_Prefabs.size())) return;
+
+	PrefabPool& pool = m_Prefabs[prefabId];
+	pool.inactive.reserve(pool.inactive.size() + count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		GameObject* object = CreatePrefabInstance(prefabId);
+		object->SetActive(false);
+		object->SetInPool(true);
+		pool.inactive.push_back(object);
+	}
+}
+
+// ===================================================================
+// PrefabCX^Xo
+// ===================================================================
+GameObject* SceneBase::Spawn(int prefabId, const Vector3& position)
+{
+	if (prefabId < 0 || prefabId >= static_cast<int>(m_Prefabs.size())) return nullptr;
+
+	PrefabPool& pool = m_Prefabs[prefabId];
+	GameObject* object = nullptr;
+
+	if (!pool.inactive.empty())
+	{
+		// ҋ@̃CX^Xėp (R|[lgEGPU\[X͂̂܂)
+		object = pool.inactive.back();
+		pool.inactive.pop_back();
+		object->SetInPool(false);
+		object->OnReuse();
+	}
+	else
+	{
+		// ȂΐVK
+		object = CreatePrefabInstance(prefabId);
+	}
+
+	object->GetTransform().SetPosition(position);
+	object->SetActive(true);
+	return object;
+}
+
+GameObject* SceneBase::Spawn(const std::string& name, const Vector3& position)
+{
+	return Spawn(FindPrefab(name), position);
+}
+
+// ===================================================================
+// CX^Xҋ@Ԃɖ߂
+// ===================================================================
+void SceneBase::Despawn(GameObject* object)
+{
+	if (!object) return;
+
+	int prefabId = object->GetPrefabId();
+	if (prefabId < 0 || prefabId >= static_cast<int>(m_Prefabs.size()))
+	{
+		// Prefab琶ĂȂ̂͒ʏ̍폜
+		RemoveGameObject(object);
+		return;
+	}
+
+	// dɖ߂Ȃ (ANeBuɂꂽ͖̂̂߂)
+	if (object->IsInPool()) return;
+
+	object->SetActive(false);
+	object->SetInPool(true);
+	m_Prefabs[prefabId].inactive.push_back(object);
+}
+
+// ===================================================================
+// PrefabVCX^X𐶐
+// ===================================================================
+GameObject* SceneBase::CreatePrefabInstance(int prefabId)
+{
+	PrefabPool& pool = m_Prefabs[prefabId];
+	const Prefab& prefab = pool.prefab;
+
+	// p Transform ̏lƂēn (ėp Reset łɖ߂)
+	GameObject* object = CreateGameObject(prefab.position, prefab.rotation, prefab.scale);
+	object->SetName(prefab.name);
+	object->SetTag(prefab.tag);
+	object->SetPrefabId(prefabId);
+
+	// R|[lg̑gݗ (GPU\[X̐͂ł̂ݍs)
+	if (prefab.build)
+	{
+		prefab.build(object);
+	}
+
+	pool.instanceCount++;
+	return object;
 }
 
 // ===================================================================
@@ -206,12 +969,106 @@ void SceneBase::DeleteObjectList()
 // ===================================================================
 void SceneBase::UpdateObjectList()
 {
+	m_UpdateScheduler.BeginFrame();
+
+	float deltaTime = Game::GetDeltaTime();
+	const Vector3& viewer = m_Camera.GetPosition();
+
 	// SĂ̗LGameObjectUpdate()Ăяo
 	for (auto& obj : m_GameObjects)
 	{
 		if (obj && obj->IsActive())
 		{
-			obj->Update();
+			// ʑ͍ŏ̍XVɊ蓖ĂiAԂȂ̂ŊԈXVet[ɋϓɎU΂j
+			if (obj->GetUpdatePhase() < 0)
+			{
+				obj->SetUpdatePhase(static_cast<int>(m_UpdateScheduler.AssignPhase()));
+			}
+
+			// J̋ŒiK߁Ãt[Sǂn
+			UpdateTier tier = m_UpdateScheduler.GetTier(obj->GetTransform().GetWorldPosition(), viewer);
+			obj->Update(deltaTime, m_UpdateScheduler.IsDue(tier, static_cast<uint32_t>(obj->GetUpdatePhase())));
+		}
+	}
+
+	// XVœTransform̃[hsm肳
+	UpdateTransforms();
+}
+
+// ===================================================================
+// [hs̈ꊇXV
+// ===================================================================
+void SceneBase::UpdateTransforms()
+{
+	// @ [Js񂪖TransformW߂SIMDł܂Ƃ߂ČvZ
+	m_BatchTransforms.clear();
+	m_BatchPositions.clear();
+	m_BatchRotations.clear();
+	m_BatchScales.clear();
+
+	for (auto& obj : m_GameObjects)
+	{
+		if (!obj) continue;
+
+		const Transform& transform = obj->GetTransform();
+		if (transform.IsLocalDirty())
+		{
+			m_BatchTransforms.push_back(&transform);
+			m_BatchPositions.push_back(transform.GetPosition());
+			m_BatchRotations.push_back(transform.GetRotationQuaternion());
+			m_BatchScales.push_back(transform.GetScale());
+		}
+	}
+
+	if (!m_BatchTransforms.empty())
+	{
+		m_BatchMatrices.resize(m_BatchTransforms.size());
+		TransformBatch::BuildWorldMatrices(
+			m_BatchPositions.data(),
+			m_BatchRotations.data(),
+			m_BatchScales.data(),
+			m_BatchMatrices.data(),
+			m_BatchTransforms.size());
+
+		for (size_t i = 0; i < m_BatchTransforms.size(); i++)
+		{
+			m_BatchTransforms[i]->SetCachedLocalMatrix(m_BatchMatrices[i]);
+		}
+	}
+
+	// A [gύX̂؂Hă[hsm
+	for (auto& obj : m_GameObjects)
+	{
+		if (!obj) continue;
+
+		const Transform& transform = obj->GetTransform();
+		if (transform.GetParent() == nullptr && transform.IsHierarchyDirty())
+		{
+			transform.UpdateHierarchy();
+		}
+	}
+
+	// B ̂ԃCfbNXXV
+	UpdateSpatialIndex();
+}
+
+// ===================================================================
+// ԃCfbNX̍XV
+// ===================================================================
+void SceneBase::UpdateSpatialIndex()
+{
+	for (auto& obj : m_GameObjects)
+	{
+		if (!obj || !obj->GetTransform().ConsumeBoundsDirty()) continue;
+
+		Bounds bounds = obj->GetWorldBounds();
+		if (obj->GetSpatialId() < 0)
+		{
+			obj->SetSpatialId(m_SpatialIndex.Insert(obj.get(), bounds));
+		}
+		else
+		{
+			m_SpatialIndex.Update(obj->GetSpatialId(), bounds);
 		}
 	}
 }
@@ -236,6 +1093,21 @@ void SceneBase::DrawObjectList(Camera* camera)
 // ===================================================================
 void SceneBase::DrawLayer(Camera* camera, RenderLayer layer)
 {
+	// WORLDw͎ɓĂ̂`
+	if (camera && layer == RenderLayer::WORLD)
+	{
+		// XVɒǉEړ̂𔽉f
+		UpdateSpatialIndex();
+
+		m_VisibleObjects.clear();
+		m_SpatialIndex.QueryFrustum(camera->GetFrustum(), m_VisibleObjects);
+		for (GameObject* obj : m_VisibleObjects)
+		{
+			obj->DrawLayer(camera, layer);
+		}
+		return;
+	}
+
 	// SĂ̗LGameObject̎w背C[`
 	for (auto& obj : m_GameObjects)
 	{
@@ -261,29 +1133,23 @@ void SceneBase::DrawAllLayers(Camera* camera)
 // ===================================================================
 GameObject* SceneBase::FindGameObjectWithTag(const std::string& tag)
 {
-	for (auto& obj : m_GameObjects)
-	{
-		if (obj && obj->GetTag() == tag)
-		{
-			return obj.get();
-		}
-	}
-	return nullptr;
+	auto objects = m_Registry.FindWithTag(tag);
+	return objects.empty() ? nullptr : objects.front();
 }
 
 // ===================================================================
 // GameObject^OŌiׂāj
 // ===================================================================
-std::vector<GameObject*> SceneBase::FindGameObjectsWithTag(const std::string& tag)
+std::span<GameObject* const> SceneBase::FindGameObjectsWithTag(const std::string& tag)
 {
-	std::vector<GameObject*> result;
+	return m_Registry.FindWithTag(tag);
+}
 
-	for (auto& obj : m_GameObjects)
-	{
-		if (obj && obj->GetTag() == tag)
-		{
-			result.push_back(obj.get());
-		}
-	}
-	return result;
+// ===================================================================
+// GameObject𖼑OŌiŏ̈̂݁j
+// ===================================================================
+GameObject* SceneBase::FindGameObjectWithName(const std::string& name)
+{
+	auto objects = m_Registry.FindWithName(name);
+	return objects.empty() ? nullptr : objects.front();
 }
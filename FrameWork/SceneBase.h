@@ -7,11 +7,24 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <span>
+#include <future>
+#include <string>
 
 #include "SystemCommon.h"
 #include "Camera.h"
 #include "GameObject.h"
+#include "GameObjectRegistry.h"
+#include "SceneArena.h"
+#include "Prefab.h"
+#include "SceneCommandBuffer.h"
+#include "LooseOctree.h"
+#include "UpdateScheduler.h"
+#include "StageFile.h"
 #include "XmlRW.h"
+#include "ResourceHandle.h"
+
+class StaticMesh;
 
 enum SceneReturnCode
 {
@@ -28,13 +41,68 @@ protected:
 	bool m_isInitialized = false;
 	bool m_isActive = false;
 	int m_nextScene = 999;
+	bool m_isResident = false;	// 풓邩 (V[؂ւɔjꎞ~)
 
 	// J
 	Camera  m_Camera;
 	
+	// GameObjectER|[lg̊mې (m_GameObjectsɐ錾Čɔj)
+	SceneArena m_Arena;
+
+	// GameObject ̃nhE^O/O (m_GameObjectsɐ錾Čɔj)
+	GameObjectRegistry m_Registry;
+
 	// GameObject Xg
-	std::vector<std::unique_ptr<GameObject>> m_GameObjects;
+	std::vector<PoolPtr<GameObject>> m_GameObjects;
+
+	// Prefab Ƃ̃CX^Xu (Prefabԍň)
+	std::vector<PrefabPool> m_Prefabs;
+	std::unordered_map<std::string, int> m_PrefabNames;	// Prefab  Prefabԍ
 private:
+	// xs\ύX (L^pƔf2ւĎg)
+	SceneCommandBuffer m_Commands;
+	SceneCommandBuffer m_FlushingCommands;
+
+	// 풓V[ƂĈꎞ~
+	bool m_isSuspended = false;
+
+	// ɉR|[lgXV̊Ԉ
+	UpdateScheduler m_UpdateScheduler;
+
+	// GameObject̋E{bNX̋ԃCfbNX
+	LooseOctree m_SpatialIndex;
+	std::vector<GameObject*> m_VisibleObjects;	// JǑʁit[ėpj
+
+	// TransformꊇXVp̍Ɨ̈it[ėpĊmۂj
+	std::vector<const Transform*> m_BatchTransforms;
+	std::vector<Vector3> m_BatchPositions;
+	std::vector<Quaternion> m_BatchRotations;
+	std::vector<Vector3> m_BatchScales;
+	std::vector<Matrix> m_BatchMatrices;
+
+	// ===================================================================
+	// Xe[Wf[^̔񓯊ǂݍ
+	// ===================================================================
+	enum class PreloadState
+	{
+		None,		// ǂݍ݂Ȃ
+		Parsing,	// Xe[Wt@Cǂݍݒ
+		Importing,	// bVǂݍݒ
+		Ready,		//  (MakeObjectList Ŏĝ҂Ă)
+	};
+	struct StagePreload
+	{
+		PreloadState state = PreloadState::None;
+		std::string stage;												// Ώۂ̃Xe[W
+		std::future<std::shared_ptr<const StageFile>> parse;			// Xe[Wt@Cǂݍ݂̌
+		std::shared_ptr<const StageFile> stageFile;						// ǂݍݍς݂̃Xe[Wt@C
+		std::unordered_map<std::string, ResourceHandle<StaticMesh>> imports;	// ǂݍݒ̃bV (t@Cň)
+		std::unordered_map<std::string, std::shared_ptr<StaticMesh>> meshes;	// ǂݍݍς݂̃bV (GPU]ς)
+	};
+	StagePreload m_Preload;
+
+	// ۑ̃^XN (SaveObjectData)
+	std::future<int> m_SaveTask;
 
 #pragma endregion
 
@@ -55,6 +123,84 @@ public:
 	bool IsInitialized() { return m_isInitialized; }	// Ă邩
 	bool IsActive() { return m_isActive; }				// sV[
 	int GetNextScene() { return m_nextScene;	 }	// ̃V[
+	bool IsResident() { return m_isResident; }			// 풓V[
+	bool IsSuspended() { return m_isSuspended; }		// ꎞ~
+
+	// ===================================================================
+	// 풓V[̈ꎞ~EĊJ
+	// GameObjectEGPU\[Xc܂܎~߁AĊJ͈ꎞIȏԂlɖ߂
+	// ===================================================================
+	// ꎞ~ (UnInit ̑ SceneManager Ă΂)
+	virtual void Suspend();
+	// ĊJ (Init ̑ SceneManager Ă΂BhNXœƎ̏Ԃ߂ꍇ͊ĂԂ)
+	virtual void Resume();
+	// 풓ĂԂɎgp郁̊TZ (oCgBV[A[iEGameObject ̈ꗗBL\[X͊܂܂Ȃ)
+	size_t GetResidentBytes() const;
+
+	// ===================================================================
+	// \ύX̒xs
+	// XVEՓ˃R[obN͂gBGame::Update ̓_ł܂Ƃ߂Ĕf
+	// ===================================================================
+	// GameObject̍폜\iPrefab̃CX^X͑ҋ@Ԃɖ߂j
+	void QueueDestroy(GameObject* object);
+	// Prefab̐\
+	void QueueSpawn(int prefabId, const Vector3& position);
+	// ς݂GameObject̒ǉ\
+	void QueueAddGameObject(PoolPtr<GameObject> object);
+	// R|[lg̒ǉ\
+	template<typename T, typename... Args>
+	void QueueAddComponent(GameObject* object, Args... args)
+	{
+		if (!object) return;
+		m_Commands.componentCommands.push_back({ object->GetHandle(),
+			[args...](GameObject* target) { target->AddComponent<T>(args...); } });
+	}
+	template<typename T, typename... Args>
+	void QueueAddMeshComponent(GameObject* object, Args... args)
+	{
+		if (!object) return;
+		m_Commands.componentCommands.push_back({ object->GetHandle(),
+			[args...](GameObject* target) { target->AddMeshComponent<T>(args...); } });
+	}
+	// R|[lg̍폜\
+	template<typename T>
+	void QueueRemoveComponent(GameObject* object)
+	{
+		if (!object) return;
+		m_Commands.componentCommands.push_back({ object->GetHandle(),
+			[](GameObject* target) { target->RemoveComponent<T>(); } });
+	}
+	template<typename T>
+	void QueueRemoveMeshComponent(GameObject* object)
+	{
+		if (!object) return;
+		m_Commands.componentCommands.push_back({ object->GetHandle(),
+			[](GameObject* target) { target->RemoveMeshComponent<T>(); } });
+	}
+
+	// \񂳂ꂽ\ύX܂Ƃ߂Ĕfi_ SceneManager Ă΂j
+	void FlushCommandBuffer();
+
+	// ===================================================================
+	// Ԍi`EAIETEhŋʂɎgj
+	// ʂ out ̖ɒǉBANeBuGameObject͊܂܂Ȃ
+	//  ʒu͒߂ UpdateTransforms _̂
+	// ===================================================================
+	void QueryFrustum(const Frustum& frustum, std::vector<GameObject*>& out) const { m_SpatialIndex.QueryFrustum(frustum, out); }
+	void QuerySphere(const Vector3& center, float radius, std::vector<GameObject*>& out) const { m_SpatialIndex.QuerySphere(center, radius, out); }
+	void QueryBox(const Bounds& box, std::vector<GameObject*>& out) const { m_SpatialIndex.QueryBox(box, out); }
+
+	// ===================================================================
+	// Xe[Wf[^̔񓯊ǂݍ
+	// xmĺEbV/eNX`̓ǂݍ݂[J[XbhōsAGPU]͖t[i߂
+	//  MakeObjectList łGameObjects
+	// ===================================================================
+	// ǂݍ݂Jn (V[؂ւO SceneManager Ă΂)
+	void BeginPreload(const std::string& stage);
+	// ǂݍ݂i߂ (CXbhŖt[ĂԁB҂̂Ȃ true)
+	bool UpdatePreload();
+	// ǂݍ݂j
+	void CancelPreload();
 
 protected:
 	// ===================================================================
@@ -62,12 +208,41 @@ protected:
 	// ===================================================================
 	// xmlt@CIuWFNg̃f[^擾ăXg쐬
 	void MakeObjectList(const char* _stage);
-	// xmlt@CɍXVf[^ۑ
+	// xmlt@C̕ύXfiOŏƍAςl̏EǉE폜̂ݍsj
+	// GameObjectER|[lgEbV͂̂܂܎g
+	void ApplyStageDiff(const char* _stage);
+	// xmlt@CɍXVf[^ۑi݂̓[J[Xbhōsj
 	void SaveObjectData(const char* _stage);
 	// GameObjectXg폜
 	void DeleteObjectList();
-	// GameObjectXgXV
+	// GameObjectA[i琶ăXgɒǉ
+	template<typename T = GameObject, typename... Args>
+	T* CreateGameObject(Args&&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value,
+			"T must be derived from GameObject");
+
+		PoolPtr<T> object = m_Arena.Create<T>(std::forward<Args>(args)...);
+		object->SetArena(&m_Arena);
+
+		T* ptr = object.get();
+		AddGameObject(std::move(object));
+		return ptr;
+	}
+	// GameObjectXgɒǉiɓo^ănh𔭍sj
+	GameObject* AddGameObject(PoolPtr<GameObject> object);
+	// GameObjectXg폜iIĂŔjj
+	void RemoveGameObject(GameObject* object);
+	// nhGameObject擾i폜ς݂Ȃnullptrj
+	GameObject* GetGameObject(GameObjectHandle handle) const { return m_Registry.Resolve(handle); }
+	// GameObjectXgXViDistanceBased ̃R|[lg̓J̋ɉĊԈj
 	void UpdateObjectList();
+	// XV̊ԈݒiiKƂ̋Ȃǁj
+	UpdateScheduler& GetUpdateScheduler() { return m_UpdateScheduler; }
+	// ύX̂Transform̃[hs܂Ƃ߂čXVit[1j
+	void UpdateTransforms();
+	// ړE`ύX̂GameObjectԃCfbNXXV
+	void UpdateSpatialIndex();
 	// GameObjectXg`iŁE݊̂ߎcj
 	void DrawObjectList(Camera* camera);
 	// GameObjectw背C[̂ݕ`
@@ -75,14 +250,44 @@ protected:
 	// GameObjectSC[Ԃɕ`
 	void DrawAllLayers(Camera* camera);
 
+	// ===================================================================
+	// PrefabEIuWFNgv[
+	// ===================================================================
+	// Prefabo^Prefabԍ擾iPrefab͏㏑j
+	int RegisterPrefab(const Prefab& prefab);
+	// PrefabPrefabԍ擾i-1j
+	int FindPrefab(const std::string& name) const;
+	// OɃCX^X𐶐đҋ@Ă
+	void PrewarmPrefab(int prefabId, size_t count);
+	// PrefabCX^Xoiҋ@̂̂΍ėpAmۂ\[XȂj
+	GameObject* Spawn(int prefabId, const Vector3& position);
+	GameObject* Spawn(const std::string& name, const Vector3& position);
+	// CX^Xҋ@Ԃɖ߂iPrefabȊO琶ꂽ͍̂폜j
+	void Despawn(GameObject* object);
+
 	// ===================================================================
 	// GameObject@^O
 	// ===================================================================
 	// GameObject^OŌiŏ̈̂݁j
 	GameObject* FindGameObjectWithTag(const std::string& tag);
 	// GameObject^OŌiׂāj
-	std::vector<GameObject*> FindGameObjectsWithTag(const std::string& tag);
+	//  Ԃl͍ւ̎QƁBGameObject̒ǉE폜E^OύXŖɂȂ̂ŕێȂ
+	std::span<GameObject* const> FindGameObjectsWithTag(const std::string& tag);
+	// GameObject𖼑OŌiŏ̈̂݁j
+	GameObject* FindGameObjectWithName(const std::string& name);
 private:
+	// PrefabVCX^X𐶐
+	GameObject* CreatePrefabInstance(int prefabId);
+	// GameObjectOďIĂԁiXg͊OȂj
+	void DetachGameObject(GameObject* object);
+
+	// Xe[Wt@C1IuWFNgGameObject쐬ăXgɒǉ
+	GameObject* CreateStageObject(const StageFile& stageFile, size_t index,
+		std::unordered_map<std::string, std::shared_ptr<StaticMesh>>& importedMeshes);
+	// GameObject̎ށEfER|[lg̑gݍ킹Xe[Wf[^ƈv邩
+	static bool MatchesStageShape(GameObject* object, const StageFile& stageFile, size_t index);
+	// Xe[Wf[^̒ligXtH[EFE^OER|[lgj𔽉fiω truej
+	static bool ApplyStageValues(GameObject* object, const StageFile& stageFile, size_t index);
 
 #pragma endregion
 };
@@ -0,0 +1,54 @@
+// ===================================================================
+// SceneCommandBuffer.h
+// XVɔGameObjectER|[lg̒ǉ/폜𗭂߂Ă
+// SceneBase::FlushCommandBuffer ł܂Ƃ߂Ĕf
+// (GameObjectXgRC_[Xg̑ɍ\ςȂ)
+// ===================================================================
+#pragma once
+#include <functional>
+#include <vector>
+
+#include "SystemCommon.h"
+#include "GameObjectRegistry.h"
+#include "SceneArena.h"
+
+class GameObject;
+
+// ===================================================================
+// SceneCommandBuffer
+// ===================================================================
+struct SceneCommandBuffer
+{
+	// Prefab̐
+	struct SpawnCommand
+	{
+		int prefabId;		// Prefabԍ
+		Vector3 position;	// ʒu
+	};
+
+	// R|[lg̒ǉE폜 (Ώۂ폜ς݂Ȃ牽Ȃ)
+	struct ComponentCommand
+	{
+		GameObjectHandle target;					// Ώ
+		std::function<void(GameObject*)> apply;		// e
+	};
+
+	std::vector<GameObjectHandle> destroys;				// 폜GameObject
+	std::vector<ComponentCommand> componentCommands;	// R|[lg (L^Ɏs)
+	std::vector<PoolPtr<GameObject>> additions;			// ǉGameObject (ς)
+	std::vector<SpawnCommand> spawns;					// Prefab琶GameObject
+
+	bool IsEmpty() const
+	{
+		return destroys.empty() && componentCommands.empty() && additions.empty() && spawns.empty();
+	}
+
+	// gɂ (mۍς݂̗eʂ͎cĎt[ōėp)
+	void Clear()
+	{
+		destroys.clear();
+		componentCommands.clear();
+		additions.clear();
+		spawns.clear();
+	}
+};
\ No newline at end of file
@@ -4,11 +4,14 @@
 // ===================================================================
 #include "SceneDebug.h"
 
+#include <filesystem>
 #include <iostream>
 
 #include "SceneManager.h"
 #include "IOManager.h"
 #include "DebugUI.h"
+#include "Game.h"
+#include "ResourceManager.h"
 
 void SceneDebug::Init()
 {
@@ -26,10 +29,14 @@ void SceneDebug::Init()
     // J
     m_Camera.Init();
 
-    // Ƃ肠IDԏIuWFNgANeBuɂ
-    m_activeObjectDebug = m_GameObjects[0].get();
+    // Ƃ肠IDԏIuWFNgANeBuɂ (ΖI)
+    m_activeObjectDebug = m_GameObjects.empty() ? nullptr : m_GameObjects[0].get();
     DebugUIInit();
 
+    // Xe[Wxml̍XVĎ
+    m_StageWatcher.Clear();
+    m_StageWatcher.WatchDirectory("data", ".xml");
+
     m_nextScene = SCENE_NONE;
 
     // 
@@ -51,6 +58,7 @@ void SceneDebug::UnInit()
     DeleteObjectList();
 
     DebugUIUnInit();
+    m_StageWatcher.Clear();
 
     // JI
     m_Camera.Uninit();
@@ -80,6 +88,10 @@ void SceneDebug::Update()
     {
         ReLoadObject();
     }
+    else
+    {
+        HotReloadStage();
+    }
 
     // GameObjectXgXV
     UpdateObjectList();
@@ -113,13 +125,38 @@ void SceneDebug::ReLoadObject()
     // IuWFNgXg쐬
     MakeObjectList(SCENE_MANAGER.GetSceneName((SCENE)m_curScene).c_str());
 
-    // Ƃ肠IDԏIuWFNgANeBuɂ
-    m_activeObjectDebug = m_GameObjects[0].get();
+    // Ƃ肠IDԏIuWFNgANeBuɂ (ΖI)
+    m_activeObjectDebug = m_GameObjects.empty() ? nullptr : m_GameObjects[0].get();
 
     // 쐬čXV
     m_preScene = m_curScene;    
 }
 
+/// <summary>
+/// Xe[Wxml̃zbg[h
+/// </summary>
+void SceneDebug::HotReloadStage()
+{
+    const std::string& stage = SCENE_MANAGER.GetSceneNameAll()[m_curScene];
+
+    for (const std::string& path : m_StageWatcher.Poll(Game::GetDeltaTime()))
+    {
+        // \̃Xe[WȊO͎ɓǂݍ܂鎞ɕϊ
+        if (std::filesystem::path(path).stem().string() != stage) continue;
+
+        // I𒆂̃IuWFNg͎cĂΑI܂܂ɂ
+        GameObjectHandle active = m_activeObjectDebug ? m_activeObjectDebug->GetHandle() : GameObjectHandle();
+
+        ApplyStageDiff(stage.c_str());
+
+        m_activeObjectDebug = GetGameObject(active);
+        if (!m_activeObjectDebug && !m_GameObjects.empty())
+        {
+            m_activeObjectDebug = m_GameObjects[0].get();
+        }
+    }
+}
+
 // ===================================================================
 // Transform̒
 // ===================================================================
@@ -152,58 +189,72 @@ void SceneDebug::DebugUI()
         {
             objectNameList.push_back(gameObject->GetName());
         }
-        int curID = m_activeObjectDebug->GetID();
+        // I𒆂̃IuWFNg̔ԍ (͈͊OȂ擪)
+        int curID = m_activeObjectDebug ? m_activeObjectDebug->GetID() : 0;
+        if (curID < 0 || curID >= static_cast<int>(objectNameList.size()))
+        {
+            curID = 0;
+        }
 
-        // IuWFNg̃R{{bNX̍쐬
-        if (ImGui::BeginCombo("Object", objectNameList[curID].c_str()))
+        // IuWFNg (̃Xe[Wzbg[h) ꍇ͑IEgXtH[oȂ
+        if (!objectNameList.empty() && m_activeObjectDebug)
         {
-            for (int i = 0; i < objectNameList.size(); i++)
+            // IuWFNg̃R{{bNX̍쐬
+            if (ImGui::BeginCombo("Object", objectNameList[curID].c_str()))
             {
-                bool isSelected = (curID == i);
-                if (ImGui::Selectable(objectNameList[i].c_str(), isSelected))
-                {
-                    curID = i; // IύX
-                    m_activeObjectDebug = m_GameObjects[curID].get();
-                }
-                if (isSelected)
+                for (int i = 0; i < objectNameList.size(); i++)
                 {
-                    ImGui::SetItemDefaultFocus();
+                    bool isSelected = (curID == i);
+                    if (ImGui::Selectable(objectNameList[i].c_str(), isSelected))
+                    {
+                        curID = i; // IύX
+                        m_activeObjectDebug = m_GameObjects[curID].get();
+                    }
+                    if (isSelected)
+                    {
+                        ImGui::SetItemDefaultFocus();
+                    }
                 }
+                ImGui::EndCombo();
             }
-            ImGui::EndCombo();
-        }
 
-        ImGui::Separator();
+            ImGui::Separator();
 
-        // gXtH[f[^
-        {
-            float position[3] =
+            // gXtH[f[^
             {
-                m_activeObjectDebug->GetTransform().GetPosition().x,
-                m_activeObjectDebug->GetTransform().GetPosition().y,
-                m_activeObjectDebug->GetTransform().GetPosition().z,
-            };
-            float rotation[3] =
-            {
-                m_activeObjectDebug->GetTransform().GetRotation().x,
-                m_activeObjectDebug->GetTransform().GetRotation().y,
-                m_activeObjectDebug->GetTransform().GetRotation().z,
-            };
-            float scale[3] =
-            {
-                m_activeObjectDebug->GetTransform().GetScale().x,
-                m_activeObjectDebug->GetTransform().GetScale().y,
-                m_activeObjectDebug->GetTransform().GetScale().z,
-            };
-
-            ImGui::SliderFloat3("Position", position, -100.0f, 100.0f);
-            ImGui::SliderFloat3("Rotation", rotation, 0.0f, 100.0f);
-            ImGui::SliderFloat3("Scale", scale, 0.0f, 100.0f);
-
-            // ύXlZbg
-            m_activeObjectDebug->GetTransform().SetPosition(Vector3(position[0], position[1], position[2]));
-            m_activeObjectDebug->GetTransform().SetRotation(Vector3(rotation[0], rotation[1], rotation[2]));
-            m_activeObjectDebug->GetTransform().SetScale(Vector3(scale[0], scale[1], scale[2]));
+                float position[3] =
+                {
+                    m_activeObjectDebug->GetTransform().GetPosition().x,
+                    m_activeObjectDebug->GetTransform().GetPosition().y,
+                    m_activeObjectDebug->GetTransform().GetPosition().z,
+                };
+                float rotation[3] =
+                {
+                    m_activeObjectDebug->GetTransform().GetRotation().x,
+                    m_activeObjectDebug->GetTransform().GetRotation().y,
+                    m_activeObjectDebug->GetTransform().GetRotation().z,
+                };
+                float scale[3] =
+                {
+                    m_activeObjectDebug->GetTransform().GetScale().x,
+                    m_activeObjectDebug->GetTransform().GetScale().y,
+                    m_activeObjectDebug->GetTransform().GetScale().z,
+                };
+
+                // ύXl̂݃Zbgit[s𖳌Ȃj
+                if (ImGui::SliderFloat3("Position", position, -100.0f, 100.0f))
+                {
+                    m_activeObjectDebug->GetTransform().SetPosition(Vector3(position[0], position[1], position[2]));
+                }
+                if (ImGui::SliderFloat3("Rotation", rotation, 0.0f, 100.0f))
+                {
+                    m_activeObjectDebug->GetTransform().SetRotation(Vector3(rotation[0], rotation[1], rotation[2]));
+                }
+                if (ImGui::SliderFloat3("Scale", scale, 0.0f, 100.0f))
+                {
+                    m_activeObjectDebug->GetTransform().SetScale(Vector3(scale[0], scale[1], scale[2]));
+                }
+            }
         }
 
         // {^
@@ -219,9 +270,72 @@ void SceneDebug::DebugUI()
 	ImGui::End();
 }
 
+void SceneDebug::ResourceDebugUI()
+{
+	ResourceCacheStats stats = M_RESOURCE.GetCacheStats();
+	auto toMB = [](size_t bytes) { return static_cast<float>(bytes / (1024.0 * 1024.0)); };
+
+	ImGui::SetNextWindowSize(ImVec2(360, 220), ImGuiCond_Once);
+	ImGui::Begin("Resources", nullptr, 0);
+
+	// ނƂ̎gp
+	if (ImGui::BeginTable("Cache", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Type");
+		ImGui::TableSetupColumn("Count");
+		ImGui::TableSetupColumn("Unused");
+		ImGui::TableSetupColumn("CPU MB");
+		ImGui::TableSetupColumn("GPU MB");
+		ImGui::TableHeadersRow();
+
+		auto row = [&](const char* label, const ResourceCacheUsage& usage)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::TextUnformatted(label);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", usage.count);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", usage.unused);
+			ImGui::TableNextColumn(); ImGui::Text("%.2f", toMB(usage.cpuBytes));
+			ImGui::TableNextColumn(); ImGui::Text("%.2f", toMB(usage.gpuBytes));
+		};
+		row("Texture", stats.textures);
+		row("Mesh", stats.meshes);
+		row("Shader", stats.shaders);
+		ImGui::EndTable();
+	}
+
+	// vƗ\Z
+	float cpuTotal = toMB(stats.textures.cpuBytes + stats.meshes.cpuBytes + stats.shaders.cpuBytes);
+	float gpuTotal = toMB(stats.textures.gpuBytes + stats.meshes.gpuBytes + stats.shaders.gpuBytes);
+	ImGui::Text("CPU %.1f / %.0f MB   GPU %.1f / %.0f MB", cpuTotal, toMB(stats.cpuBudget), gpuTotal, toMB(stats.gpuBudget));
+	ImGui::Text("Evicted %zu   Pending %zu textures, %zu meshes", stats.evicted, stats.pendingTextures, stats.pendingMeshes);
+
+	// \Z̕ύX (MB, 0 ͖)
+	int cpuBudget = static_cast<int>(stats.cpuBudget >> 20);
+	int gpuBudget = static_cast<int>(stats.gpuBudget >> 20);
+	bool changed = ImGui::DragInt("CPU budget", &cpuBudget, 1.0f, 0, 4096, "%d MB");
+	changed |= ImGui::DragInt("GPU budget", &gpuBudget, 1.0f, 0, 4096, "%d MB");
+	if (changed)
+	{
+		M_RESOURCE.SetMemoryBudget(size_t(cpuBudget) << 20, size_t(gpuBudget) << 20);
+	}
+
+	if (ImGui::Button("Trim"))
+	{
+		M_RESOURCE.Trim();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Print"))
+	{
+		M_RESOURCE.PrintCacheInfo();
+	}
+
+	ImGui::End();
+}
+
 void SceneDebug::DebugUIInit()
 {
 	DebugUI::RedistDebugFunction(std::bind(&SceneDebug::DebugUI, this));
+	DebugUI::RedistDebugFunction(std::bind(&SceneDebug::ResourceDebugUI, this));
 }
 
 void SceneDebug::DebugUIUnInit()
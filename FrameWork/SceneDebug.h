@@ -4,6 +4,7 @@
 // ===================================================================
 #pragma once
 #include "SceneBase.h"
+#include "FileWatcher.h"
 
 class SceneDebug : public SceneBase
 {
@@ -13,6 +14,7 @@ private:
 	GameObject* m_activeObjectDebug = nullptr;
 	int m_curScene = 0; // I𒆂̃V[
 	int m_preScene = 0; // ȎIV[
+	FileWatcher m_StageWatcher; // Xe[Wxml̍XVĎizbg[hpj
 #pragma endregion
 #pragma region ֐
 	// ===================================================================
@@ -20,6 +22,8 @@ private:
 	// ===================================================================
 	// fobOpUI̓e
 	void DebugUI();
+	// \[XLbV̎gpʁE\Z
+	void ResourceDebugUI();
 	// 
 	void DebugUIInit();
 	// I
@@ -28,6 +32,8 @@ private:
 	void DebugUIRender();
 
 	void ReLoadObject();
+	// ҏW̃Xe[WxmlXVꂽ獷f
+	void HotReloadStage();
 	// IuWFNgf[^̕ύXxmlt@Cɕۑ
 	void SaveData();
 	// fobOʂ甲
@@ -23,19 +23,15 @@ void SceneGame::Init()
     // Q[ԏ
     m_GameTime = 0.0f;
 
+    // gCŉxV[Ȃ̂ŏ풓
+    m_isResident = true;
+
     using namespace DirectX::SimpleMath;
 
     // IuWFNgXg쐬
+    // (vC[ړR|[lg̓Xe[Wf[^Ɋ܂܂)
     MakeObjectList(SCENE_MANAGER.GetSceneName(SCENE_GAME).c_str());
 
-    // ǉR|[lg
-    {
-        // vC[ړR|[lg
-        auto* mover = FindGameObjectWithTag("Player")->AddComponent<PlayerMoverComponent>(5.0f, 3.0f);
-
-        std::cout << "[SceneGame] Player created" << std::endl;
-    }
-
     // J
     m_Camera.Init();
 
@@ -56,6 +52,14 @@ void SceneGame::Init()
     std::cout << "" << std::endl;
 }
 
+void SceneGame::Resume()
+{
+    SceneBase::Resume();
+
+    // Q[ԏ
+    m_GameTime = 0.0f;
+}
+
 void SceneGame::UnInit()
 {
     std::cout << "[SceneGame] UnInit" << std::endl;
@@ -22,6 +22,7 @@ private:
 public:
     void Init() override;
     void UnInit() override;
+    void Resume() override;
     void Update() override;
     void Draw() override;
     void Draw(Camera*) override;
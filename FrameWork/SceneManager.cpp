@@ -1,5 +1,8 @@
 #include "SceneManager.h"
+#include "ResourceManager.h"
 
+#include <algorithm>
+#include <iostream>
 #include <memory>
 
 void SceneManager::Init()
@@ -14,6 +17,13 @@ void SceneManager::Init()
 
 void SceneManager::UnInit()
 {
+	// ꎞ~̏풓V[̌㏈
+	for (SCENE scene : m_suspendedScenes)
+	{
+		m_scene->GetScene(scene)->UnInit();
+	}
+	m_suspendedScenes.clear();
+
 	// ŏIV[̌㏈
 	if (m_scene->GetScene(m_currentScene)->IsInitialized())
 	{
@@ -39,20 +49,106 @@ void SceneManager::Draw()
 	m_scene->GetScene(m_currentScene)->Draw();
 }
 
+// \񂳂ꂽ\ύX܂Ƃ߂Ĕf
+void SceneManager::FlushCommands()
+{
+	SceneBase* scene = m_scene->GetScene(m_currentScene);
+	if (scene->IsInitialized())
+	{
+		scene->FlushCommandBuffer();
+	}
+}
+
 // eV[V[ύXʒm󂯎
+// V[̃Xe[Wf[^𗠂œǂݍ݁A܂ł͌V[𓮂
 void SceneManager::ChangeScene()
 {
 	SCENE next = (SCENE)m_scene->GetScene(m_currentScene)->GetNextScene();
-	if (next == SCENE_NONE) return;
+	if (next == SCENE_NONE)
+	{
+		// ؂ւꂽ
+		if (IsLoading())
+		{
+			m_scene->GetScene(m_loadingScene)->CancelPreload();
+			m_loadingScene = SCENE_NONE;
+		}
+		return;
+	}
 
-	// V[̏I
-	m_scene->GetScene(m_currentScene)->UnInit();
+	// ǂݍ݊JniXe[Wf[^V[̂݁Bǂݍݒɍs悪ς蒼j
+	// 풓Ăꍇ͓ǂݍݕsv
+	if (next != m_loadingScene && next >= 0 && next < SCENE_NUM &&
+		!m_scene->GetScene(next)->IsSuspended())
+	{
+		if (IsLoading())
+		{
+			m_scene->GetScene(m_loadingScene)->CancelPreload();
+		}
+		m_loadingScene = next;
+		m_scene->GetScene(next)->BeginPreload(GetSceneName(next));
+	}
+
+	// ǂݍ݊҂
+	if (IsLoading())
+	{
+		if (!m_scene->GetScene(m_loadingScene)->UpdatePreload()) return;
+		m_loadingScene = SCENE_NONE;
+	}
+
+	// V[̏Ii풓V[͔jꎞ~j
+	SceneBase* current = m_scene->GetScene(m_currentScene);
+	if (current->IsResident() && m_residentBudget > 0)
+	{
+		current->Suspend();
+		m_suspendedScenes.push_back(m_currentScene);
+	}
+	else
+	{
+		current->UnInit();
+	}
 
 	// V[ɐ؂ւ
 	m_currentScene = next;
 
-	// V[Jn
-	m_scene->GetScene(m_currentScene)->Init();
+	// V[Jniꎞ~ȂĊĴ݁j
+	SceneBase* scene = m_scene->GetScene(m_currentScene);
+	if (scene->IsSuspended())
+	{
+		m_suspendedScenes.erase(std::find(m_suspendedScenes.begin(), m_suspendedScenes.end(), m_currentScene));
+		scene->Resume();
+	}
+	else
+	{
+		scene->Init();
+	}
+
+	EvictResidentScenes();
+}
 
+//  (V[EResourceManager) 𒴂풓V[Â̂j
+void SceneManager::EvictResidentScenes()
+{
+	size_t total = 0;
+	for (SCENE scene : m_suspendedScenes)
+	{
+		total += m_scene->GetScene(scene)->GetResidentBytes();
+	}
+
+	// ؂ւŎQƂȂȂL\[XɎ̂Ă
+	M_RESOURCE.Trim();
+
+	// 풓V[QƂĂ郁bVEeNX`̓V[j܂Ŏ̂ĂȂ̂ŁA
+	// ResourceManager \Z𒴂܂܂ȂÂV[jĎQƂ
+	while (!m_suspendedScenes.empty() && (total > m_residentBudget || M_RESOURCE.IsOverMemoryBudget()))
+	{
+		SceneBase* oldest = m_scene->GetScene(m_suspendedScenes.front());
+		total -= (std::min)(total, oldest->GetResidentBytes());
+
+		std::cout << "[SceneManager] Evict resident scene: " << GetSceneName(m_suspendedScenes.front()) << std::endl;
+		oldest->UnInit();
+		m_suspendedScenes.erase(m_suspendedScenes.begin());
+
+		M_RESOURCE.Trim();
+	}
 }
 
@@ -9,6 +9,13 @@ class SceneManager
 private:
 	SCENE m_currentScene;
 	std::unique_ptr<Scene> m_scene;
+	SCENE m_loadingScene = SCENE_NONE;	// œǂݍݒ̃V[ (SCENE_NONE Ȃ疳)
+
+	// ꎞ~̏풓V[ (擪قǒgĂȂ)
+	std::vector<SCENE> m_suspendedScenes;
+	// 풓V[ɎgĂ悢̏ (oCgBV[A[i̍vBÂ̂j)
+	// bVEeNX` ResourceManager ̗\ZŊǗ (炪ĂԂÂ̂j)
+	size_t m_residentBudget = 16 * 1024 * 1024;
 
 public:
 	// V[ʂŎgp
@@ -17,6 +24,8 @@ public:
 
 #pragma region ֐
 private:
+	//  (V[EResourceManager) 𒴂풓V[Â̂j
+	void EvictResidentScenes();
 
 public:
 	void Init();
@@ -24,6 +33,16 @@ public:
 	void Update();
 	void Draw();
 	void ChangeScene();
+	// V[؂ւ (V[̓ǂݍݑ҂)
+	bool IsLoading() const { return m_loadingScene != SCENE_NONE; }
+
+	// 풓V[̃ݒ (0Ȃ풓Ȃ)
+	void SetResidentBudget(size_t bytes) { m_residentBudget = bytes; EvictResidentScenes(); }
+	size_t GetResidentBudget() const { return m_residentBudget; }
+	// ݂̃V[ɗ\񂳂ꂽ\ύX܂Ƃ߂Ĕf (Game::Update ̓_ŌĂ)
+	void FlushCommands();
+	// ݂̃V[擾
+	SceneBase* GetCurrentScene() { return m_scene->GetScene(m_currentScene); }
 
 	std::string GetSceneName(SCENE _scene) { return m_scene->GetSceneName(_scene); }
 	std::vector<std::string>& GetSceneNameAll() { return m_scene->GetSceneNameAll(); }
@@ -28,24 +28,9 @@ void SceneResult::Init()
     using namespace DirectX::SimpleMath;
 
     // IuWFNgXg쐬
+    // (JΈړR|[lg̓Xe[Wf[^Ɋ܂܂BJ Draw() ŃZbg)
     MakeObjectList(SCENE_MANAGER.GetSceneName(SCENE_RESULT).c_str());
 
-    // ǉR|[lg
-    {
-        // ===================================================================
-        // JΈړR|[lgǉ
-        //  J͂܂nullptrAUpdate()ŎgpODraw()Ă΂ăZbg
-        // ===================================================================
-        // vC[ړR|[lg
-        auto* mover = FindGameObjectWithTag("ModelObject")->AddComponent<CameraRelativeMoverComponent>(
-            nullptr,    // J͌ŃZbg
-            8.0f,       // ړx
-            3.0f        // ]x
-        );
-
-        std::cout << "[SceneResult] ModelObject created with camera-relative movement" << std::endl;
-    }
-
     // J
     m_Camera.Init();
 
@@ -20,6 +20,9 @@ void SceneTitle::Init()
     // IuWFNg폜
     DeleteObjectList();
 
+    // x߂ĂV[Ȃ̂ŏ풓
+    m_isResident = true;
+
     using namespace DirectX::SimpleMath;
 
     // IuWFNgXg쐬
@@ -27,9 +30,7 @@ void SceneTitle::Init()
 
     // ǉR|[lg
     {
-        // L[uɎ]R|[lg
-        auto* rotator = FindGameObjectWithTag("TitleCube")->AddComponent<RotatorComponent>(Vector3(0.5f, 1.0f, 0.3f));
-        std::cout << "[SceneTitle] TitleCube created" << std::endl;
+        // (L[u̎]R|[lg̓Xe[Wf[^Ɋ܂܂)
         // pl2D`R|[lgǉ
         auto* render2d = FindGameObjectWithTag("Floor")->AddComponent<Renderer2DComponent>();
         render2d->SetTexture("asset/texture/floor.jpg");
@@ -4,9 +4,9 @@
 //=======================================
 //Shader쐬
 //=======================================
-void Shader::Create(std::string vs, std::string ps)
+void Shader::Create(std::string vs, std::string ps, EVertexFormat format)
 {
-	// _f[^̒`
+	// _f[^̒`iVERTEX_3Dj
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
 		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,		0,	D3D11_APPEND_ALIGNED_ELEMENT,	D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -15,17 +15,31 @@ void Shader::Create(std::string vs, std::string ps)
 		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,			0,	D3D11_APPEND_ALIGNED_ELEMENT,   D3D11_INPUT_PER_VERTEX_DATA, 0 }
 	};
 
-	unsigned int numElements = ARRAYSIZE(layout);
+	// _f[^̒`iVERTEX_PACKEDBVF[_[ɂ float œnj
+	D3D11_INPUT_ELEMENT_DESC packedlayout[] =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM,	0,	D3D11_APPEND_ALIGNED_ELEMENT,	D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM,			0,	D3D11_APPEND_ALIGNED_ELEMENT,	D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM,		0,	D3D11_APPEND_ALIGNED_ELEMENT,	D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,			0,	D3D11_APPEND_ALIGNED_ELEMENT,   D3D11_INPUT_PER_VERTEX_DATA, 0 }
+	};
+
+	D3D11_INPUT_ELEMENT_DESC* elements = format == VF_PACKED ? packedlayout : layout;
+	unsigned int numElements = format == VF_PACKED ? ARRAYSIZE(packedlayout) : ARRAYSIZE(layout);
 
 	ID3D11Device* device = Renderer::GetDevice();
 
+	unsigned int vsSize = 0;
+	unsigned int psSize = 0;
+
 	// _VF[_[IuWFNg𐶐Aɒ_CAEg
 	HRESULT hr = Renderer::CreateVertexShader(
 		&m_pVertexShader,
 		&m_pVertexLayout,
-		layout,
+		elements,
 		numElements,
-		vs.c_str()
+		vs.c_str(),
+		&vsSize
 		);
 	if (FAILED(hr)) {
 		MessageBox(nullptr, "CreateVertexShader error", "error", MB_OK);
@@ -36,13 +50,16 @@ void Shader::Create(std::string vs, std::string ps)
 
 	hr = Renderer::CreatePixelShader(			// sNZVF[_[IuWFNg𐶐
 		&m_pPixelShader,
-		ps.c_str()
+		ps.c_str(),
+		&psSize
 		);
 	if (FAILED(hr)) {
 		MessageBox(nullptr, "CreatePixelShader error", "error", MB_OK);
 		return;
 	}
 
+	m_BytecodeSize = size_t(vsSize) + psSize;
+
 	return;
 }
 
@@ -2,6 +2,7 @@
 #include	<wrl/client.h>
 #include	<string>
 #include	<d3d11.h>
+#include	"renderer.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -10,11 +11,16 @@ using Microsoft::WRL::ComPtr;
 //-----------------------------------------------------------------------------
 class Shader{
 public:
-	void Create(std::string vs, std::string ps);
+	// format ͒_VF[_[󂯎钸_̌`i̓CAEgj
+	void Create(std::string vs, std::string ps, EVertexFormat format = VF_3D);
 	void SetGPU();
+
+	// RpCς݂̃oCgR[h̑傫 (_+sNZB\Zł͂VF[_[̑傫Ƃ݂Ȃ)
+	size_t GetBytecodeSize() const { return m_BytecodeSize; }
 private:
 	ComPtr<ID3D11VertexShader> m_pVertexShader;		// _VF[_[
 	ComPtr<ID3D11PixelShader>  m_pPixelShader;		// sNZVF[_[
 	ComPtr<ID3D11InputLayout>  m_pVertexLayout;		// _CAEg
+	size_t m_BytecodeSize = 0;							// oCgR[h̑傫
 };
 
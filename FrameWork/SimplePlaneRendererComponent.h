@@ -9,6 +9,7 @@
 #include "VertexBuffer.h"
 #include "IndexBuffer.h"
 #include "Shader.h"
+#include "ResourceManager.h"
 #include <vector>
 
 class SimplePlaneRendererComponent : public MeshComponent
@@ -88,13 +89,21 @@ public:
         m_VertexBuffer.Create(m_Vertices);
         m_IndexBuffer.Create(m_Indices);
 
-        // VF[_[쐬
-        m_Shader = std::make_shared<Shader>();
-        m_Shader->Create("shader/litTextureVS.hlsl", "shader/litTexturePS.hlsl");
+        // VF[_[擾 (LbVς݂Ȃ狤LBCX^XƂɃRpCȂ)
+        m_Shader = M_RESOURCE.LoadShader("shader/litTextureVS.hlsl", "shader/litTexturePS.hlsl");
 
         m_Initialized = true;
     }
 
+    // ===================================================================
+    // E{bNX (_͈̔)
+    // ===================================================================
+    bool GetLocalBounds(Bounds& bounds) const override
+    {
+        bounds = Bounds(Vector3(-1.0f, 0.0f, -1.0f), Vector3(1.0f, 0.0f, 1.0f));
+        return true;
+    }
+
     // ===================================================================
     // `
     // ===================================================================
@@ -31,6 +31,16 @@ public:
     // ===================================================================
     ~SphereCollider() override = default;
 
+    // ===================================================================
+    // Xe[Wۑ鍀 (ComponentReflection.h)
+    // ===================================================================
+    static constexpr const char* TypeName = "SphereCollider";
+    static constexpr auto ReflectFields()
+    {
+        return std::tuple_cat(ReflectColliderFields(), std::make_tuple(
+            MakeField("Radius", &SphereCollider::m_Radius)));
+    }
+
     // ===================================================================
     // Փ˔iI[o[Chj
     // ===================================================================
@@ -0,0 +1,278 @@
+// ===================================================================
+// StageFile.cpp
+// Xe[Wf[^̃oCi`̕ϊEǂݍ
+// ===================================================================
+#include "StageFile.h"
+#include "XmlRW.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// ===================================================================
+// ޖ  
+// ===================================================================
+StageObjectType GetStageObjectType(std::string_view typeName)
+{
+	if (typeName == "SimpleCube")	return StageObjectType::SimpleCube;
+	if (typeName == "SimplePlane")	return StageObjectType::SimplePlane;
+	if (typeName == "Model")		return StageObjectType::Model;
+	return StageObjectType::Unknown;
+}
+
+// ===================================================================
+//   ޖ
+// ===================================================================
+const char* GetStageObjectTypeName(StageObjectType type)
+{
+	switch (type)
+	{
+	case StageObjectType::SimpleCube:	return "SimpleCube";
+	case StageObjectType::SimplePlane:	return "SimplePlane";
+	case StageObjectType::Model:		return "Model";
+	default:							return "";
+	}
+}
+
+// ===================================================================
+// Xe[WJ
+// ===================================================================
+std::shared_ptr<const StageFile> StageFile::Open(const std::string& stage)
+{
+	namespace fs = std::filesystem;
+
+	// Xe[W𕡐̃XbhɕϊȂ悤
+	static std::mutex mutex;
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::string source = GetSourcePath(stage);
+	std::string binary = GetBinaryPath(stage);
+
+	// xml ̕VΕϊ (xml ΃oCî܂܎g)
+	std::error_code ec;
+	bool hasSource = fs::exists(source, ec);
+	bool hasBinary = fs::exists(binary, ec);
+	if (hasSource && (!hasBinary || fs::last_write_time(source, ec) > fs::last_write_time(binary, ec)))
+	{
+		std::cout << "[StageFile] Compiling " << source << std::endl;
+		if (!Compile(stage))
+		{
+			std::cerr << "[StageFile] Failed to compile " << source << std::endl;
+		}
+	}
+
+	auto file = std::make_shared<StageFile>();
+	if (!file->Map(binary))
+	{
+		// `ÂEĂꍇ͍蒼ĂxJ
+		if (!hasSource || !Compile(stage) || !file->Map(binary))
+		{
+			std::cerr << "[StageFile] Failed to open " << binary << std::endl;
+			return nullptr;
+		}
+	}
+	return file;
+}
+
+// ===================================================================
+// xml oCiɕϊ
+// ===================================================================
+bool StageFile::Compile(const std::string& stage)
+{
+	// \ (1ɂ܂Ƃ߂)
+	std::vector<StageStringEntry> strings;
+	std::string stringData;
+	std::unordered_map<std::string, uint32_t> stringIndex;
+	auto addString = [&](const std::string& str) -> uint32_t
+	{
+		auto it = stringIndex.find(str);
+		if (it != stringIndex.end()) return it->second;
+
+		uint32_t index = static_cast<uint32_t>(strings.size());
+		strings.push_back({ static_cast<uint32_t>(stringData.size()), static_cast<uint32_t>(str.size()) });
+		stringData.append(str);
+		stringData.push_back('\0');
+		stringIndex.emplace(str, index);
+		return index;
+	};
+
+	// IuWFNgzɋl߂
+	// (xml  Object vfƂɓǂݐi߂̂ŁAt@CŜIuWFNgf[^̔z͎Ȃ)
+	std::vector<StageObjectRecord> records;
+	std::vector<StageTransform> transforms;
+	std::vector<StageColor> colors;
+	std::vector<StageComponentRecord> components;
+	std::vector<StageAttributeRecord> attributes;
+
+	XmlRW xml;
+	int ret = xml.ReadObjects(stage.c_str(), [&](const ObjectData& object)
+	{
+		StageObjectRecord record{};
+		record.type = GetStageObjectType(object.objectType);
+		record.name = addString(object.objectName);
+		record.tag = addString(object.objectTag);
+		record.typeName = addString(object.objectType);
+		record.fileName = addString(object.fileName);
+		record.texture = addString(object.texture);
+		record.componentFirst = static_cast<uint32_t>(components.size());
+		record.componentCount = static_cast<uint32_t>(object.components.size());
+		records.push_back(record);
+
+		for (const ComponentData& component : object.components)
+		{
+			components.push_back({ addString(component.type),
+				static_cast<uint32_t>(attributes.size()), static_cast<uint32_t>(component.attributes.size()) });
+			for (const auto& [name, value] : component.attributes)
+			{
+				attributes.push_back({ addString(name), addString(value) });
+			}
+		}
+
+		StageTransform transform{};
+		std::copy(std::begin(object.pos), std::end(object.pos), transform.pos);
+		std::copy(std::begin(object.rot), std::end(object.rot), transform.rot);
+		std::copy(std::begin(object.scl), std::end(object.scl), transform.scl);
+		transforms.push_back(transform);
+
+		StageColor color{};
+		std::copy(std::begin(object.color), std::end(object.color), color.rgba);
+		colors.push_back(color);
+	});
+	if (ret == -1)
+	{
+		return false;
+	}
+
+	// zu߂ (ez4oCgEn߂)
+	auto align = [](size_t offset) { return static_cast<uint32_t>((offset + 3) & ~size_t(3)); };
+
+	StageFileHeader header{};
+	header.magic = StageFileHeader::Magic;
+	header.version = StageFileHeader::Version;
+	header.objectCount = static_cast<uint32_t>(records.size());
+	header.stringCount = static_cast<uint32_t>(strings.size());
+	header.stringDataSize = static_cast<uint32_t>(stringData.size());
+	header.stringTableOffset = align(sizeof(StageFileHeader));
+	header.stringDataOffset = align(header.stringTableOffset + strings.size() * sizeof(StageStringEntry));
+	header.objectOffset = align(header.stringDataOffset + stringData.size());
+	header.transformOffset = align(header.objectOffset + records.size() * sizeof(StageObjectRecord));
+	header.colorOffset = align(header.transformOffset + transforms.size() * sizeof(StageTransform));
+	header.componentCount = static_cast<uint32_t>(components.size());
+	header.attributeCount = static_cast<uint32_t>(attributes.size());
+	header.componentOffset = align(header.colorOffset + colors.size() * sizeof(StageColor));
+	header.attributeOffset = align(header.componentOffset + components.size() * sizeof(StageComponentRecord));
+	header.fileSize = align(header.attributeOffset + attributes.size() * sizeof(StageAttributeRecord));
+
+	// ꎞt@CɏĂu (̃t@Cǂ܂Ȃ)
+	std::string path = GetBinaryPath(stage);
+	std::string tempPath = path + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out) return false;
+
+		auto writeAt = [&out](uint32_t offset, const void* data, size_t size)
+		{
+			// E킹̌Ԃ0Ŗ߂
+			while (static_cast<size_t>(out.tellp()) < offset) out.put('\0');
+			out.write(static_cast<const char*>(data), size);
+		};
+		writeAt(0, &header, sizeof(header));
+		writeAt(header.stringTableOffset, strings.data(), strings.size() * sizeof(StageStringEntry));
+		writeAt(header.stringDataOffset, stringData.data(), stringData.size());
+		writeAt(header.objectOffset, records.data(), records.size() * sizeof(StageObjectRecord));
+		writeAt(header.transformOffset, transforms.data(), transforms.size() * sizeof(StageTransform));
+		writeAt(header.colorOffset, colors.data(), colors.size() * sizeof(StageColor));
+		writeAt(header.componentOffset, components.data(), components.size() * sizeof(StageComponentRecord));
+		writeAt(header.attributeOffset, attributes.data(), attributes.size() * sizeof(StageAttributeRecord));
+		writeAt(header.fileSize, nullptr, 0);
+
+		if (!out) return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+// ===================================================================
+// }bvĒg؂
+// ===================================================================
+bool StageFile::Map(const std::string& path)
+{
+	if (!m_File.Open(path)) return false;
+
+	const std::byte* data = m_File.GetData();
+	size_t size = m_File.GetSize();
+
+	// ͈͓4oCgE
+	auto inRange = [size](uint32_t offset, size_t bytes)
+	{
+		return offset % 4 == 0 && offset <= size && bytes <= size - offset;
+	};
+
+	bool valid = size >= sizeof(StageFileHeader);
+	const StageFileHeader* header = reinterpret_cast<const StageFileHeader*>(data);
+	valid = valid &&
+		header->magic == StageFileHeader::Magic &&
+		header->version == StageFileHeader::Version &&
+		header->fileSize == size &&
+		inRange(header->stringTableOffset, size_t(header->stringCount) * sizeof(StageStringEntry)) &&
+		inRange(header->stringDataOffset, header->stringDataSize) &&
+		inRange(header->objectOffset, size_t(header->objectCount) * sizeof(StageObjectRecord)) &&
+		inRange(header->transformOffset, size_t(header->objectCount) * sizeof(StageTransform)) &&
+		inRange(header->colorOffset, size_t(header->objectCount) * sizeof(StageColor)) &&
+		inRange(header->componentOffset, size_t(header->componentCount) * sizeof(StageComponentRecord)) &&
+		inRange(header->attributeOffset, size_t(header->attributeCount) * sizeof(StageAttributeRecord));
+
+	if (valid)
+	{
+		m_Header = header;
+		m_Strings = reinterpret_cast<const StageStringEntry*>(data + header->stringTableOffset);
+		m_StringData = reinterpret_cast<const char*>(data + header->stringDataOffset);
+		m_Objects = reinterpret_cast<const StageObjectRecord*>(data + header->objectOffset);
+		m_Transforms = reinterpret_cast<const StageTransform*>(data + header->transformOffset);
+		m_Colors = reinterpret_cast<const StageColor*>(data + header->colorOffset);
+		m_Components = reinterpret_cast<const StageComponentRecord*>(data + header->componentOffset);
+		m_Attributes = reinterpret_cast<const StageAttributeRecord*>(data + header->attributeOffset);
+
+		// ͈̔͂ƔԍmF (ȍ~̎QƂł͊mFȂ)
+		for (uint32_t i = 0; valid && i < header->stringCount; i++)
+		{
+			valid = size_t(m_Strings[i].offset) + m_Strings[i].length < header->stringDataSize;
+		}
+		for (uint32_t i = 0; valid && i < header->objectCount; i++)
+		{
+			const StageObjectRecord& r = m_Objects[i];
+			valid = r.name < header->stringCount && r.tag < header->stringCount &&
+				r.typeName < header->stringCount && r.fileName < header->stringCount &&
+				r.texture < header->stringCount &&
+				r.componentFirst <= header->componentCount && r.componentCount <= header->componentCount - r.componentFirst;
+		}
+		for (uint32_t i = 0; valid && i < header->componentCount; i++)
+		{
+			const StageComponentRecord& c = m_Components[i];
+			valid = c.type < header->stringCount &&
+				c.attributeFirst <= header->attributeCount && c.attributeCount <= header->attributeCount - c.attributeFirst;
+		}
+		for (uint32_t i = 0; valid && i < header->attributeCount; i++)
+		{
+			valid = m_Attributes[i].name < header->stringCount && m_Attributes[i].value < header->stringCount;
+		}
+	}
+
+	if (!valid)
+	{
+		m_File.Close();
+		m_Header = nullptr;
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+// ===================================================================
+// StageFile.h
+// Xe[Wf[^̃oCi` (data/SceneXXX.stage)
+// ҏWp̌f[^ xml ̂܂܁Bxml ̕VΓǂݍݎɎŕϊ
+// ǂݍ݂̓}bvāAẑ܂܎QƂ (̕l̉͂Ȃ)
+//
+// t@C\ (S4oCgE)
+//   StageFileHeader
+//   StageStringEntry[stringCount]	\ (1ɂ܂Ƃ߂)
+//   char[stringDataSize]				{ (e '\0' I[)
+//   StageObjectRecord[objectCount]	ށEԍ
+//   StageTransform[objectCount]		ʒuE]Egk
+//   StageColor[objectCount]			F
+//   StageComponentRecord[componentCount]	R|[lg (IuWFNgɕ)
+//   StageAttributeRecord[attributeCount]	R|[lg̑ (R|[lgɕ)
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <span>
+#include <string_view>
+
+#include "MappedFile.h"
+
+// ===================================================================
+// IuWFNg̎ (xml  ObjectType)
+// ===================================================================
+enum class StageObjectType : uint32_t
+{
+	Unknown,		// `R|[lgȂ
+	SimpleCube,		// SimpleCubeRendererComponent
+	SimplePlane,	// SimplePlaneRendererComponent
+	Model,			// MeshRendererComponent
+};
+
+// ޖ  
+StageObjectType GetStageObjectType(std::string_view typeName);
+//   ޖ (Unknown ͋󕶎)
+const char* GetStageObjectTypeName(StageObjectType type);
+
+// ===================================================================
+// t@C̍\
+// ===================================================================
+struct StageFileHeader
+{
+	static constexpr uint32_t Magic = 0x42475453;	// "STGB"
+	static constexpr uint32_t Version = 2;			// `ςグ (Ât@C͍蒼)
+
+	uint32_t magic;
+	uint32_t version;
+	uint32_t objectCount;
+	uint32_t stringCount;
+	uint32_t stringDataSize;
+	uint32_t stringTableOffset;
+	uint32_t stringDataOffset;
+	uint32_t objectOffset;
+	uint32_t transformOffset;
+	uint32_t colorOffset;
+	uint32_t componentCount;
+	uint32_t attributeCount;
+	uint32_t componentOffset;
+	uint32_t attributeOffset;
+	uint32_t fileSize;
+};
+
+struct StageStringEntry
+{
+	uint32_t offset;	// {̂̐擪̈ʒu
+	uint32_t length;	//  ('\0' ܂܂Ȃ)
+};
+
+struct StageObjectRecord
+{
+	StageObjectType type;	// 
+	uint32_t name;			// ȉA\̔ԍ
+	uint32_t tag;
+	uint32_t typeName;
+	uint32_t fileName;
+	uint32_t texture;
+	uint32_t componentFirst;	// R|[lgz͈̔
+	uint32_t componentCount;
+};
+
+struct StageTransform
+{
+	float pos[3];
+	float rot[3];
+	float scl[3];
+};
+
+struct StageColor
+{
+	float rgba[4];
+};
+
+struct StageComponentRecord
+{
+	uint32_t type;				// \̔ԍ (^)
+	uint32_t attributeFirst;	// z͈̔
+	uint32_t attributeCount;
+};
+
+struct StageAttributeRecord
+{
+	uint32_t name;		// \̔ԍ
+	uint32_t value;
+};
+
+// ===================================================================
+// StageFile
+// ===================================================================
+class StageFile
+{
+private:
+	MappedFile m_File;
+	const StageFileHeader* m_Header = nullptr;
+	const StageStringEntry* m_Strings = nullptr;
+	const char* m_StringData = nullptr;
+	const StageObjectRecord* m_Objects = nullptr;
+	const StageTransform* m_Transforms = nullptr;
+	const StageColor* m_Colors = nullptr;
+	const StageComponentRecord* m_Components = nullptr;
+	const StageAttributeRecord* m_Attributes = nullptr;
+
+public:
+	// ===================================================================
+	// ǂݍ݁Eϊ
+	// ===================================================================
+
+	// Xe[WJ (oCi xml ÂΕϊĂJBs nullptr)
+	// [J[XbhĂł悢
+	static std::shared_ptr<const StageFile> Open(const std::string& stage);
+	// xml oCiɕϊ
+	static bool Compile(const std::string& stage);
+
+	// pX
+	static std::string GetSourcePath(const std::string& stage) { return "data/" + stage + ".xml"; }
+	static std::string GetBinaryPath(const std::string& stage) { return "data/" + stage + ".stage"; }
+
+	// ===================================================================
+	// Q (Ԃl͂ StageFile ĂԂ̂ݗL)
+	// ===================================================================
+	size_t GetObjectCount() const { return m_Header->objectCount; }
+
+	StageObjectType GetType(size_t index) const { return m_Objects[index].type; }
+	std::string_view GetName(size_t index) const { return GetString(m_Objects[index].name); }
+	std::string_view GetTag(size_t index) const { return GetString(m_Objects[index].tag); }
+	std::string_view GetTypeName(size_t index) const { return GetString(m_Objects[index].typeName); }
+	std::string_view GetFileName(size_t index) const { return GetString(m_Objects[index].fileName); }
+	std::string_view GetTexture(size_t index) const { return GetString(m_Objects[index].texture); }
+	const StageTransform& GetTransform(size_t index) const { return m_Transforms[index]; }
+	const StageColor& GetColor(size_t index) const { return m_Colors[index]; }
+
+	// R|[lg (^EEl GetString ň)
+	std::span<const StageComponentRecord> GetComponents(size_t index) const
+	{
+		return { m_Components + m_Objects[index].componentFirst, m_Objects[index].componentCount };
+	}
+	std::span<const StageAttributeRecord> GetAttributes(const StageComponentRecord& component) const
+	{
+		return { m_Attributes + component.attributeFirst, component.attributeCount };
+	}
+
+	std::string_view GetString(uint32_t index) const
+	{
+		const StageStringEntry& entry = m_Strings[index];
+		return std::string_view(m_StringData + entry.offset, entry.length);
+	}
+
+private:
+	// }bvĒg؂
+	bool Map(const std::string& path);
+};
\ No newline at end of file
@@ -1,87 +1,322 @@
 #include	"StaticMesh.h"
 #include	"AssimpPerse.h"
+#include	"MeshFile.h"
+#include	"MeshOptimizer.h"
+#include	"MeshSimplifier.h"
+#include	"VertexPacker.h"
+#include	<algorithm>
+#include	<iostream>
+#include	<sstream>
+#include	<stdexcept>
+
+StaticMesh::StaticMesh() = default;
+StaticMesh::~StaticMesh() = default;
 
 void StaticMesh::Load(std::string filename, std::string texturedirectory)
 {
-	std::vector<AssimpPerse::SUBSET> subsets{};					// TuZbg
-	std::vector<std::vector<AssimpPerse::VERTEX>> vertices{};	// _f[^ibVPʁj
-	std::vector<std::vector<unsigned int>> indices{};			// CfbNXf[^ibVPʁj
-	std::vector<AssimpPerse::MATERIAL> materials{};				// }eA
-	std::vector<std::unique_ptr<Texture>> embededtextures{};	// eNX`Q
+	// ϊς݃t@Ct@CƈvĂ΁AAssimp ʂɂ̂܂ܓǂ
+	if (auto cooked = MeshFile::Open(filename))
+	{
+		LoadCooked(std::move(cooked), texturedirectory);
+		return;
+	}
+
+	// t@CǂݍŁA񂩂gϊς݃t@Co
+	std::vector<const Texture*> embeddedtextures = Import(filename, texturedirectory);
+
+	// eNX`̓~bvăubNkĂ珑o
+	std::vector<TextureCookData> cookedtextures(embeddedtextures.size());
+	std::vector<const TextureCookData*> embeddeddata(embeddedtextures.size(), nullptr);
+	for (size_t i = 0; i < embeddedtextures.size(); i++)
+	{
+		const Texture* texture = embeddedtextures[i];
+		if (texture && texture->GetPendingPixels())
+		{
+			cookedtextures[i] = Texture::BuildCookData(texture->GetPendingPixels(), texture->GetWidth(), texture->GetHeight(), TF_AUTO);
+			embeddeddata[i] = &cookedtextures[i];
+		}
+	}
 
-	// assimpgpăff[^擾
-	AssimpPerse::GetModelData(filename, texturedirectory);
+	MeshCookData data{};
+	data.vertices = m_packedvertices;
+	data.indices = m_indices;
+	data.subsets = m_subsets;
+	data.lods = m_lodsubsets;
+	data.materials = m_materials;
+	data.textureNames = m_texturenames;
+	data.embeddedTextures = embeddeddata;
+	data.bounds = m_bounds;
+	m_vertexcount = m_packedvertices.size();
+	m_indexcount = m_indices.size();
+	if (!MeshFile::Cook(filename, data))
+	{
+		// oȂΓǂݍ񂾂̂̂܂܎gieNX` RGBA 1~bvj
+		std::cerr << "[StaticMesh] Failed to cook " + filename + "\n";
+		return;
+	}
 
-	subsets = AssimpPerse::GetSubsets();		// TuZbg擾
-	vertices = AssimpPerse::GetVertices();		// _f[^ibVPʁj
-	indices = AssimpPerse::GetIndices();		// CfbNXf[^ibVPʁj
-	materials = AssimpPerse::GetMaterials();	// }eA擾
+	// ot@CǂݒieNX`kς݂̃~bvɂȂAȍ~ƓԂɂȂj
+	if (auto cooked = MeshFile::Open(filename))
+	{
+		LoadCooked(std::move(cooked), texturedirectory);
+	}
+}
 
-	m_textures = AssimpPerse::GetTextures();	// eNX`擾	
+// ϊς݃t@Cǂݍ
+// _ECfbNX͕At@C}bv܂ Upload ł璼ڃobt@
+// iTuZbgE}eAA] CPU Ŏĝ𕡐j
+void StaticMesh::LoadCooked(std::unique_ptr<const MeshFile> cooked, const std::string& texturedirectory)
+{
+	// Import ̒ɓǂݒꍇ̂ŁAǂݍ񂾂͎̂̂ĂĂ
+	m_packedvertices.clear();
+	m_packedvertices.shrink_to_fit();
+	m_indices.clear();
+	m_indices.shrink_to_fit();
+	m_lodsubsets.clear();
+	m_texturenames.clear();
+	m_textures.clear();
 
-	// _f[^쐬
-	for (const auto& mv : vertices)
+	const MeshFile& file = *cooked;
+	auto materials = file.GetMaterials();
+	m_materials.assign(materials.begin(), materials.end());
+	m_bounds = file.GetBounds();
+	m_vertexcount = file.GetVertices().size();
+	m_indexcount = file.GetIndices().size();
+
+	auto readSubsets = [&file](size_t lod)
 	{
-		for (auto& v : mv)
+		std::vector<SUBSET> subsets;
+		subsets.reserve(file.GetSubsets(lod).size());
+		for (const MeshSubsetRecord& record : file.GetSubsets(lod))
 		{
-			VERTEX_3D vertex{};
-			vertex.position = DirectX::SimpleMath::Vector3(v.pos.x, v.pos.y, v.pos.z);
-			vertex.normal = DirectX::SimpleMath::Vector3(v.normal.x, v.normal.y, v.normal.z);
-			vertex.uv = DirectX::SimpleMath::Vector2(v.texcoord.x, v.texcoord.y);
-			vertex.color = DirectX::SimpleMath::Color(v.color.r, v.color.g, v.color.b, v.color.a);
-
-			m_vertices.emplace_back(vertex);
+			SUBSET subset{};
+			subset.IndexNum = record.indexNum;
+			subset.VertexNum = record.vertexNum;
+			subset.IndexBase = record.indexBase;
+			subset.VertexBase = record.vertexBase;
+			subset.MaterialIdx = record.materialIdx;
+			subset.MtrlName = std::string(file.GetString(record.mtrlName));
+			subsets.emplace_back(subset);
 		}
+		return subsets;
+	};
+	m_subsets = readSubsets(0);
+	for (size_t lod = 1; lod < file.GetLodCount(); lod++)
+	{
+		m_lodsubsets.emplace_back(readSubsets(lod));
 	}
 
-	// CfbNXf[^쐬
-	for (const auto& mi : indices)
+	// eNX`ieNX`͈kς݂̃~bvt@C璼ڎQƁAOt@C̓fR[hj
+	m_texturenames.reserve(materials.size());
+	m_textures.resize(materials.size());
+	for (size_t i = 0; i < materials.size(); i++)
 	{
-		for (auto& index : mi)
+		const MeshTextureRecord& record = file.GetTextures()[i];
+		m_texturenames.emplace_back(file.GetString(record.name));
+		if (m_texturenames.back().empty())
+		{
+			continue;
+		}
+
+		auto texture = std::make_unique<Texture>();
+		bool sts = record.width > 0
+			? texture->SetMips(static_cast<DXGI_FORMAT>(record.format), record.width, record.height, file.GetTextureMips(record))
+			: texture->Decode(texturedirectory + "/" + m_texturenames.back());
+		if (sts)
 		{
-			m_indices.emplace_back(index);
+			m_textures[i] = std::move(texture);
 		}
 	}
 
-	// TuZbgf[^쐬
-	for (const auto& sub : subsets)
+	m_file = std::move(cooked);
+}
+
+// assimp Ōt@CǂݍށiԂl̓}eAƂ̓eNX`BOt@C nullptrj
+std::vector<const Texture*> StaticMesh::Import(const std::string& filename, const std::string& texturedirectory)
+{
+	// _ECfbNXETuZbg̓oɒڏ܂ieNX`̓fR[ĥ݁j
+	std::vector<AssimpPerse::MaterialData> materials{};
+	if (!AssimpPerse::LoadModel(filename, texturedirectory, m_vertices, m_indices, m_subsets, materials))
+	{
+		throw std::runtime_error("failed to import " + filename);
+	}
+
+	// nځE_LbVEI[o[h[E_tFb`̍œKiʂ͕ϊς݃t@Cɕۑj
+	MeshOptimizer::Stats stats = MeshOptimizer::Optimize(m_vertices, m_indices, m_subsets);
+	// [J[XbhŌĂ΂̂ŁA1sɂ܂Ƃ߂Ă1ŏoĩXbh̏o͂ƍȂj
+	std::ostringstream log;
+	log << "[StaticMesh] Optimized " << filename
+		<< ": vertices " << stats.verticesBefore << " -> " << stats.verticesAfter
+		<< ", ACMR " << stats.acmrBefore << " -> " << stats.acmrAfter << "\n";
+	std::cout << log.str();
+
+	// LODiCfbNX̂݁Bϊς݃t@Cɕۑj
+	GenerateLods();
+
+	// E{bNXiCX^XƂɒ_𑖍Ȃ悤A1񂾂߂j
+	if (!m_vertices.empty())
 	{
-		SUBSET subset{};
-		subset.VertexBase = sub.VertexBase; // _̊Jnʒu
-		subset.VertexNum = sub.VertexNum; // TuZbg̒_
-		subset.IndexBase = sub.IndexBase;  // CfbNX̊Jnʒu
-		subset.IndexNum = sub.IndexNum; // TuZbg̃CfbNX
-		subset.MtrlName = sub.mtrlname; // }eA
-		subset.MaterialIdx = sub.materialindex; // }eAz̃CfbNX
-		m_subsets.emplace_back(subset);
+		m_bounds = Bounds(m_vertices[0].position, m_vertices[0].position);
+		for (const auto& vertex : m_vertices)
+		{
+			m_bounds.Encapsulate(vertex.position);
+		}
 	}
 
+	// _kiE{bNXɂBȍ~͈kς݂̒_j
+	VertexPacker::Pack(m_vertices, m_bounds, m_packedvertices);
+	m_vertices.clear();
+	m_vertices.shrink_to_fit();
+
 	// }eAf[^쐬
-	for (const auto& m : materials)
+	std::vector<const Texture*> embeddedtextures(materials.size(), nullptr);
+	m_materials.reserve(materials.size());
+	m_texturenames.reserve(materials.size());
+	m_textures.reserve(materials.size());
+	for (size_t i = 0; i < materials.size(); i++)
 	{
-		MATERIAL material{};
-		material.Ambient = DirectX::SimpleMath::Color(
-			m.Ambient.r, m.Ambient.g, m.Ambient.b, m.Ambient.a);
-		material.Diffuse = DirectX::SimpleMath::Color(
-			m.Diffuse.r, m.Diffuse.g, m.Diffuse.b, m.Diffuse.a);
+		AssimpPerse::MaterialData& m = materials[i];
+		if (m.textureembedded)
+		{
+			embeddedtextures[i] = m.texture.get();
+		}
+		m_materials.emplace_back(m.material);
+		m_texturenames.emplace_back(std::move(m.texturename));
+		m_textures.emplace_back(std::move(m.texture));
+	}
+	return embeddedtextures;
+}
+
+// LOD 
+// 1O LOD ̊eTuZbg QEM ŊȗACfbNXCfbNXžɑ
+// iTuZbgPʂȂ̂Ń}eA̋E͂܂ȂB_ LOD0 ̂̂Lj
+void StaticMesh::GenerateLods()
+{
+	m_lodsubsets.clear();
 
-		material.Specular = DirectX::SimpleMath::Color(
-			m.Specular.r, m.Specular.g, m.Specular.b, m.Specular.a);
-		material.Emission = DirectX::SimpleMath::Color(
-			m.Emission.r, m.Emission.g, m.Emission.b, m.Emission.a);
-		material.Shiness = m.Shiness;
+	for (size_t lod = 1; lod < MaxLodCount; lod++)
+	{
+		std::vector<SUBSET> subsets = GetSubsets(lod - 1);
+		const size_t firstIndex = m_indices.size();
+		size_t before = 0;
+		size_t after = 0;
+		float error = 0.0f;
 
-		if (m.texturename.empty())
+		// Ŏg LOD قǑ傫Ȍ덷
+		const float maxError = 0.01f * static_cast<float>(1 << (lod - 1));
+
+		std::vector<unsigned int> source;
+		std::vector<unsigned int> simplified;
+		for (SUBSET& subset : subsets)
 		{
-			material.TextureEnable = FALSE;
-			m_texturenames.emplace_back("");
+			source.assign(m_indices.begin() + subset.IndexBase, m_indices.begin() + subset.IndexBase + subset.IndexNum);
+			simplified.resize(source.size());
+
+			size_t target = static_cast<size_t>(source.size() / 3 * LodReduction) * 3;
+			float subsetError = 0.0f;
+			size_t count = MeshSimplifier::Simplify(simplified.data(), source.data(), source.size(),
+				m_vertices.data() + subset.VertexBase, subset.VertexNum, target, maxError, &subsetError);
+			MeshOptimizer::OptimizeVertexCache(simplified.data(), count, subset.VertexNum);
+
+			subset.IndexBase = static_cast<unsigned int>(m_indices.size());
+			subset.IndexNum = static_cast<unsigned int>(count);
+			m_indices.insert(m_indices.end(), simplified.begin(), simplified.begin() + count);
+
+			before += source.size();
+			after += count;
+			error = std::max(error, subsetError);
+		}
+
+		// قƂǌȂ΁iEpڂ΂̃bVȂǁjȏȂ
+		if (after > before * 0.8f)
+		{
+			m_indices.resize(firstIndex);
+			break;
+		}
+
+		// Import ƓA1sɂ܂Ƃ߂Ă1ŏo
+		std::ostringstream log;
+		log << "[StaticMesh] LOD" << lod << ": triangles " << before / 3 << " -> " << after / 3
+			<< ", error " << error << "\n";
+		std::cout << log.str();
+		m_lodsubsets.emplace_back(std::move(subsets));
+	}
+}
+
+// ʏ̑傫 LOD I
+size_t StaticMesh::SelectLod(float screenSize) const
+{
+	size_t lod = 0;
+	while (lod + 1 < GetLodCount() && screenSize < LodScreenSizes[lod])
+	{
+		lod++;
+	}
+	return lod;
+}
+
+// _̈ʒu̕
+QUANTIZATION StaticMesh::GetQuantization() const
+{
+	return VertexPacker::GetQuantization(m_bounds);
+}
+
+// gpʁiCPUj
+size_t StaticMesh::GetCpuBytes() const
+{
+	size_t bytes = m_packedvertices.size() * sizeof(VERTEX_PACKED) + m_indices.size() * sizeof(unsigned int) +
+		m_materials.size() * sizeof(MATERIAL) + m_subsets.size() * sizeof(SUBSET);
+	if (m_file)
+	{
+		bytes += m_file->GetVertices().size_bytes() + m_file->GetIndices().size_bytes();
+	}
+	for (const auto& texture : m_textures)
+	{
+		if (texture) bytes += texture->GetCpuBytes();
+	}
+	return bytes;
+}
+
+// gpʁiGPUj
+size_t StaticMesh::GetGpuBytes() const
+{
+	size_t bytes = m_uploaded ? m_vertexcount * sizeof(VERTEX_PACKED) + m_indexcount * m_renderer.GetIndexSize() : 0;
+	for (const auto& texture : m_textures)
+	{
+		if (texture) bytes += texture->GetGpuBytes();
+	}
+	return bytes;
+}
+
+// fR[hς݃eNX`ƒ_ECfbNXobt@GPUɓ]
+void StaticMesh::Upload()
+{
+	// _ECfbNXobt@1񂾂
+	if (!m_uploaded)
+	{
+		if (m_file)
+		{
+			m_renderer.Init(m_file->GetVertices(), m_file->GetIndices());
 		}
 		else
 		{
-			material.TextureEnable = TRUE;
-			m_texturenames.emplace_back(m.texturename);
+			m_renderer.Init(m_packedvertices, m_indices);
 		}
+		m_uploaded = true;
+	}
 
-		m_materials.emplace_back(material);
+	// eNX`̓}bv̈QƂĂ̂ŁAOɓ]
+	for (auto& texture : m_textures)
+	{
+		if (texture && texture->IsPendingUpload())
+		{
+			texture->Upload();
+		}
 	}
+
+	//  CPU ̒_ECfbNXEeNX`͗vȂ̂ŁA}bvE
+	m_file.reset();
+	m_packedvertices.clear();
+	m_packedvertices.shrink_to_fit();
+	m_indices.clear();
+	m_indices.shrink_to_fit();
 }
\ No newline at end of file
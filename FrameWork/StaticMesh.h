@@ -6,11 +6,55 @@
 #include	<memory>
 #include	"Texture.h"
 #include	"Mesh.h"
+#include	"MeshRenderer.h"
+#include	"Bounds.h"
 #include	"renderer.h"
 
+class MeshFile;
+
 class StaticMesh : public Mesh {
 public:
+	// LOD ̐̏ (LOD0 = ̃bV܂)
+	static constexpr size_t MaxLodCount = 4;
+	// LOD ƂɎOp`ǂꂾ炷 (1O LOD ɑ΂銄)
+	static constexpr float LodReduction = 0.5f;
+	// LOD ؂ւʏ̑傫 (ʂ̍ɑ΂銄B菬Ύ LOD)
+	static constexpr float LodScreenSizes[MaxLodCount - 1] = { 0.25f, 0.125f, 0.0625f };
+
+	// MeshFile ͑O錾݂̂Ȃ̂ŁAEj StaticMesh.cpp ōs
+	StaticMesh();
+	~StaticMesh();
+
+	// fǂݍ݁EeNX`̃fR[hiCPÛ݁B[J[XbhĂł悢j
+	// ϊς݃t@CiMeshFilej΂ǂ݁A assimp œǂݍŏo
 	void Load(std::string filename, std::string texturedirectory="");
+	// fR[hς݃eNX`ƒ_ECfbNXobt@GPUɓ]iCXbhŌĂԁj
+	void Upload();
+
+	// _ECfbNXobt@ĩbVgSR|[lgŋLj
+	// _ VERTEX_PACKED Ȃ̂ŁAVF[_[ VF_PACKED ōA`O GetQuantization n
+	MeshRenderer<VERTEX_PACKED>& GetRenderer() {
+		return m_renderer;
+	}
+
+	// _ECfbNXi_ECfbNX CPU ̕ Upload ɉj
+	size_t GetVertexCount() const {
+		return m_vertexcount;
+	}
+	size_t GetIndexCount() const {
+		return m_indexcount;
+	}
+	// _̈ʒu̕iE{bNX狁߂j
+	QUANTIZATION GetQuantization() const;
+
+	// gpʁiCPU: _ECfbNXE]҂̃eNX` / GPU: obt@EeNX`j
+	size_t GetCpuBytes() const;
+	size_t GetGpuBytes() const;
+
+	// _狁߂E{bNXiLoad ɌvZj
+	const Bounds& GetBounds() const {
+		return m_bounds;
+	}
 
 	const std::vector<MATERIAL>& GetMaterials() {
 		return m_materials;
@@ -20,18 +64,40 @@ public:
 		return m_subsets;
 	}
 
+	// LODi_obt@͋LATuZbg̃CfbNX͈̔͂Ⴄj
+	size_t GetLodCount() const {
+		return 1 + m_lodsubsets.size();
+	}
+	const std::vector<SUBSET>& GetSubsets(size_t lod) const {
+		return lod == 0 || lod > m_lodsubsets.size() ? m_subsets : m_lodsubsets[lod - 1];
+	}
+	// ʏ̑傫iCamera::GetScreenSizej LOD I
+	size_t SelectLod(float screenSize) const;
+
 	const std::vector<std::string>& GetTextureNames() {
 		return m_texturenames;
 	}
 
-	std::vector<std::unique_ptr<Texture>> GetTextures() {
-		return std::move(m_textures);
+	//  ȑO͏LƕԂĂ߁A2ڈȍ~̌ĂяoŋɂȂĂ
+	const std::vector<std::unique_ptr<Texture>>& GetTextures() {
+		return m_textures;
 	}
 
 private:
+	void LoadCooked(std::unique_ptr<const MeshFile> file, const std::string& texturedirectory);
+	std::vector<const Texture*> Import(const std::string& filename, const std::string& texturedirectory);
+	void GenerateLods();
 
 	std::vector<MATERIAL> m_materials;	    // }eA
 	std::vector<std::string> m_texturenames;			// eNX`
 	std::vector<SUBSET> m_subsets;						// TuZbg
+	std::vector<std::vector<SUBSET>> m_lodsubsets;		// LOD1 ȍ~̃TuZbg
 	std::vector<std::unique_ptr<Texture>>	m_textures;	// eNX`Q
+	std::vector<VERTEX_PACKED> m_packedvertices;		// kς݂̒_iImport ̂݁BUpload ɉj
+	std::unique_ptr<const MeshFile> m_file;				// ϊς݃t@Ci_ECfbNX𕡐 Upload ܂Ŏj
+	size_t m_vertexcount = 0;							// _
+	size_t m_indexcount = 0;							// CfbNX
+	MeshRenderer<VERTEX_PACKED> m_renderer;				// GPUobt@iLj
+	bool m_uploaded = false;							// GPUobt@쐬ς݂
+	Bounds m_bounds;									// E{bNX
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+// ===================================================================
+// StringId.h
+// 𐮐IDɒuiC^[j
+// ͕KIDɂȂ̂ŁArEnbVZōς
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+class StringId
+{
+private:
+	uint32_t m_Value = InvalidValue;
+
+	static constexpr uint32_t InvalidValue = UINT32_MAX;
+
+	// ===================================================================
+	// C^[\
+	// ===================================================================
+	struct Table
+	{
+		std::unordered_map<std::string, uint32_t> ids;	//   ID
+		std::deque<std::string> strings;				// ID   (dequeȂ̂ŎQƂɂȂȂ)
+
+		Table()
+		{
+			// 󕶎͏ID 0
+			ids.emplace("", 0);
+			strings.emplace_back("");
+		}
+	};
+	static Table& GetTable()
+	{
+		static Table table;
+		return table;
+	}
+
+	explicit StringId(uint32_t value) : m_Value(value) {}
+
+public:
+	StringId() = default;
+
+	// ===================================================================
+	// 
+	// ===================================================================
+
+	// o^ID擾io^ς݂ȂIDԂj
+	static StringId Intern(const std::string& str)
+	{
+		Table& table = GetTable();
+		auto it = table.ids.find(str);
+		if (it != table.ids.end())
+		{
+			return StringId(it->second);
+		}
+
+		uint32_t id = static_cast<uint32_t>(table.strings.size());
+		table.strings.push_back(str);
+		table.ids.emplace(str, id);
+		return StringId(id);
+	}
+
+	// o^ς݂̕ID擾io^Ȃ疳IDԂB\͑₳Ȃj
+	static StringId Find(const std::string& str)
+	{
+		Table& table = GetTable();
+		auto it = table.ids.find(str);
+		return it != table.ids.end() ? StringId(it->second) : StringId();
+	}
+
+	// ===================================================================
+	// 擾
+	// ===================================================================
+	bool IsValid() const { return m_Value != InvalidValue; }
+	uint32_t GetValue() const { return m_Value; }
+
+	// ̕擾
+	const std::string& GetString() const
+	{
+		Table& table = GetTable();
+		return IsValid() ? table.strings[m_Value] : table.strings[0];
+	}
+
+	bool operator==(const StringId& other) const { return m_Value == other.m_Value; }
+	bool operator!=(const StringId& other) const { return m_Value != other.m_Value; }
+};
\ No newline at end of file
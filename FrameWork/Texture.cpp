@@ -3,79 +3,175 @@
 #include	"Texture.h"
 #include	"stb_image.h"
 #include	"renderer.h"
+#include	"BlockCompressor.h"
+#include	"MipmapGenerator.h"
 
-// eNX`[h
-bool Texture::Load(const std::string& filename)
+// eNX`j
+Texture::~Texture()
 {
-	bool sts = true;
-	unsigned char* pixels;
+	// GPUɓ]ȂsNZ
+	if (m_pixels) {
+		stbi_image_free(m_pixels);
+		m_pixels = nullptr;
+	}
+}
 
-	// 摜ǂݍ
-	pixels = stbi_load(filename.c_str(), &m_width, &m_height, &m_bpp, 4);
-	if (pixels == nullptr) {
-		std::cout << filename.c_str() << " Load error " << std::endl;
+// eNX`[h
+bool Texture::Load(const std::string& filename, ETextureFormat format)
+{
+	if (!Decode(filename, format)) {
 		return false;
 	}
+	return Upload();
+}
 
-	// eNX`2D\[X
-	ComPtr<ID3D11Texture2D> pTexture;
-
-	D3D11_TEXTURE2D_DESC desc;
-	ZeroMemory(&desc, sizeof(desc));
-
-	desc.Width = m_width;
-	desc.Height = m_height;
-	desc.MipLevels = 1;
-	desc.ArraySize = 1;
-	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;			// RGBA
-	desc.SampleDesc.Count = 1;
-	desc.Usage = D3D11_USAGE_DEFAULT;
-	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	desc.CPUAccessFlags = 0;
+// eNX`烍[h
+bool Texture::LoadFromFemory(const unsigned char* Data, int len) {
 
-	D3D11_SUBRESOURCE_DATA subResource{};
-	subResource.pSysMem = pixels;
-	subResource.SysMemPitch = desc.Width * 4;			// RGBA = 4 bytes per pixel
-	subResource.SysMemSlicePitch = 0;
+	if (!DecodeFromMemory(Data, len)) {
+		return false;
+	}
+	return Upload();
+}
 
-	ID3D11Device* device = Renderer::GetDevice();
+// 摜t@CfR[hiGPUɂ͐GȂj
+bool Texture::Decode(const std::string& filename, ETextureFormat format)
+{
+	ReleasePending();
+
+	// ϊς݃t@Ct@CƈvĂ΁AfR[hɂ̂܂܎giTF_RGBA8 ͕ϊȂj
+	if (auto cooked = format != TF_RGBA8 ? TextureFile::Open(filename, format) : nullptr) {
+		m_width = static_cast<int>(cooked->GetWidth());
+		m_height = static_cast<int>(cooked->GetHeight());
+		m_bpp = 4;
+		m_mips = cooked->GetMips();
+		m_mipFormat = cooked->GetFormat();
+		m_file = std::move(cooked);
+		m_texname = filename;
+		return true;
+	}
 
-	HRESULT hr = device->CreateTexture2D(&desc, &subResource, pTexture.GetAddressOf());
-	if (FAILED(hr)) {
-		stbi_image_free(pixels);
+	// 摜ǂݍ
+	m_pixels = stbi_load(filename.c_str(), &m_width, &m_height, &m_bpp, 4);
+	if (m_pixels == nullptr) {
+		std::cout << filename.c_str() << " Load error " << std::endl;
 		return false;
 	}
 
-	// SRV
-	hr = device->CreateShaderResourceView(pTexture.Get(), nullptr, m_srv.GetAddressOf());
-	if (FAILED(hr)) {
-		stbi_image_free(pixels);
-		return false;
+	m_texname = filename;
+	if (format == TF_RGBA8) {
+		return true;
 	}
 
-	// sNZC[W
-	stbi_image_free(pixels);
+	// ~bvEkς݂̃t@CoāA]is RGBA 1~bv̂܂܁j
+	if (!Cook(filename, format)) {
+		std::cout << filename.c_str() << " Cook error " << std::endl;
+		return true;
+	}
+	if (auto cooked = TextureFile::Open(filename, format)) {
+		m_mips = cooked->GetMips();
+		m_mipFormat = cooked->GetFormat();
+		m_file = std::move(cooked);
+		stbi_image_free(m_pixels);
+		m_pixels = nullptr;
+	}
+	return true;
+}
 
-	// eNX`
-	pTexture->Release();
+// ~bvĈkAϊς݃t@Co
+bool Texture::Cook(const std::string& filename, ETextureFormat format) const
+{
+	return TextureFile::Cook(filename, BuildCookData(m_pixels, m_width, m_height, format));
+}
 
-	return true;
+// RGBA ̃sNZ~bvĈk
+TextureCookData Texture::BuildCookData(const unsigned char* rgba, int width, int height, ETextureFormat format)
+{
+	// `߂iTF_AUTO ͔̉f BC3A BC1j
+	ETextureFormat actual = format;
+	if (actual == TF_AUTO) {
+		bool opaque = true;
+		for (size_t i = 0; opaque && i < size_t(width) * height; i++) {
+			opaque = rgba[i * 4 + 3] == 255;
+		}
+		actual = opaque ? TF_BC1 : TF_BC3;
+	}
+
+	// ubNk͍ŏi̕E4̔{łȂƍȂiD3D11̐ĵŃ~bv݂̂ɂ
+	if (actual != TF_RGBA8 && (width % 4 != 0 || height % 4 != 0)) {
+		actual = TF_RGBA8;
+	}
+
+	TextureCookData data{};
+	data.format = format;
+	data.dxgiFormat = BlockCompressor::GetDxgiFormat(actual);
+	data.width = static_cast<uint32_t>(width);
+	data.height = static_cast<uint32_t>(height);
+
+	std::vector<MipmapGenerator::MipLevel> levels = MipmapGenerator::Generate(rgba, data.width, data.height);
+	data.mips.reserve(levels.size());
+	for (MipmapGenerator::MipLevel& level : levels) {
+		if (actual == TF_RGBA8) {
+			data.mips.emplace_back(std::move(level.pixels));
+		}
+		else {
+			data.mips.emplace_back(BlockCompressor::Compress(level.pixels.data(), level.width, level.height, actual));
+		}
+	}
+	return data;
 }
 
-// eNX`烍[h
-bool Texture::LoadFromFemory(const unsigned char* Data, int len) {
+// GPU]҂̂̂̂Ă
+void Texture::ReleasePending()
+{
+	if (m_pixels) {
+		stbi_image_free(m_pixels);
+		m_pixels = nullptr;
+	}
+	m_mips.clear();
+	m_file.reset();
+}
 
-	bool sts = true;
-	unsigned char* pixels;
+// ̉摜fR[hiGPUɂ͐GȂj
+bool Texture::DecodeFromMemory(const unsigned char* Data, int len)
+{
+	ReleasePending();
 
 	// 摜ǂݍ
-	pixels = stbi_load_from_memory(Data,
+	m_pixels = stbi_load_from_memory(Data,
 		len,
 		&m_width,
 		&m_height,
 		&m_bpp,
 		STBI_rgb_alpha);
 
+	return m_pixels != nullptr;
+}
+
+// ϊς݂̃~bvQƂĎiGPUɂ͐GȂj
+bool Texture::SetMips(DXGI_FORMAT format, int width, int height, std::span<const TextureMip> mips)
+{
+	ReleasePending();
+
+	if (mips.empty() || width <= 0 || height <= 0) {
+		return false;
+	}
+
+	m_mips.assign(mips.begin(), mips.end());
+	m_mipFormat = format;
+	m_width = width;
+	m_height = height;
+	m_bpp = 4;
+	return true;
+}
+
+// fR[hς݂̃sNZGPUɓ]
+bool Texture::Upload()
+{
+	if (m_pixels == nullptr && m_mips.empty()) {
+		return false;
+	}
+
 	// eNX`2D\[X
 	ComPtr<ID3D11Texture2D> pTexture;
 
@@ -84,40 +180,47 @@ bool Texture::LoadFromFemory(const unsigned char* Data, int len) {
 
 	desc.Width = m_width;
 	desc.Height = m_height;
-	desc.MipLevels = 1;
 	desc.ArraySize = 1;
-	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;			// RGBA
 	desc.SampleDesc.Count = 1;
 	desc.Usage = D3D11_USAGE_DEFAULT;
 	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 	desc.CPUAccessFlags = 0;
 
-	D3D11_SUBRESOURCE_DATA subResource{};
-	subResource.pSysMem = pixels;
-	subResource.SysMemPitch = desc.Width * 4;			// RGBA = 4 bytes per pixel
-	subResource.SysMemSlicePitch = 0;
+	std::vector<D3D11_SUBRESOURCE_DATA> subResources;
+	m_gpuBytes = 0;
+	if (!m_mips.empty()) {
+		// ϊς݂̃~bviS~bv̂܂܁Bk`̃sb`̓ubN1sj
+		desc.MipLevels = static_cast<UINT>(m_mips.size());
+		desc.Format = m_mipFormat;
+		for (const TextureMip& mip : m_mips) {
+			subResources.push_back({ mip.data, mip.rowPitch, 0 });
+			m_gpuBytes += mip.size;
+		}
+	}
+	else {
+		desc.MipLevels = 1;
+		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;		// RGBA
+		subResources.push_back({ m_pixels, desc.Width * 4, 0 });	// RGBA = 4 bytes per pixel
+		m_gpuBytes = size_t(m_width) * m_height * 4;
+	}
 
 	ID3D11Device* device = Renderer::GetDevice();
 
-	HRESULT hr = device->CreateTexture2D(&desc, &subResource, pTexture.GetAddressOf());
+	HRESULT hr = device->CreateTexture2D(&desc, subResources.data(), pTexture.GetAddressOf());
+
+	// ]҂̃sNZEt@CiۂɊւ炸CPU͕svj
+	ReleasePending();
+
 	if (FAILED(hr)) {
-		stbi_image_free(pixels);
 		return false;
 	}
 
 	// SRV
 	hr = device->CreateShaderResourceView(pTexture.Get(), nullptr, m_srv.GetAddressOf());
 	if (FAILED(hr)) {
-		stbi_image_free(pixels);
 		return false;
 	}
 
-	// sNZC[W
-	stbi_image_free(pixels);
-
-	// eNX`
-	pTexture->Release();
-
 	return true;
 }
 
@@ -4,6 +4,10 @@
 #include	<string>
 #include	<wrl/client.h> // ComPtr̒`܂ރwb_t@C
 #include	<filesystem>
+#include	<memory>
+#include	<span>
+#include	<vector>
+#include	"TextureFile.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -18,9 +22,61 @@ class Texture
 	int m_width; // 
 	int m_height; // 
 	int m_bpp; // BPP
+
+	unsigned char* m_pixels = nullptr; // fR[hς݂GPU]̃sNZ (RGBA)
+	std::unique_ptr<const TextureFile> m_file; // GPU]̕ϊς݃t@C (~bvEkς)
+	std::vector<TextureMip> m_mips; // GPU]̃~bv (m_file ASetMips œnꂽ̈w)
+	DXGI_FORMAT m_mipFormat = DXGI_FORMAT_UNKNOWN; // m_mips ̌`
+	size_t m_gpuBytes = 0; // ]eNX`̑傫
 public:
-	bool Load(const std::string& filename);
+	Texture() = default;
+	~Texture();
+
+	Texture(const Texture&) = delete;
+	Texture& operator=(const Texture&) = delete;
+
+	// ǂݍ݁ifR[h{GPU]j
+	bool Load(const std::string& filename, ETextureFormat format = TF_AUTO);
 	bool LoadFromFemory(const unsigned char* data, int len);
 
+	// fR[ĥ݁iCPUB[J[XbhĂł悢j
+	// ϊς݃t@CiTextureFileB~bvEubNkς݁j΂ǂ݁A
+	// Ή摜fR[hă~bvAformat ňkďo
+	//  TF_RGBA8 ƃǂނ́iDecodeFromMemoryj͕ϊ RGBA 1~bv
+	//    iAgX̓ubNkŉA~bvłׂ͗̃Z邽߁j
+	//    f̓eNX`͕ϊς݃bViMeshFilejɈkς݂̃~bvƂēASetMips œn
+	bool Decode(const std::string& filename, ETextureFormat format = TF_AUTO);
+	bool DecodeFromMemory(const unsigned char* data, int len);
+	// ϊς݂̃~bvQƂĎiȂBdata  Upload ܂ŌĂяoێ邱Ɓj
+	bool SetMips(DXGI_FORMAT format, int width, int height, std::span<const TextureMip> mips);
+
+	// RGBA ̃sNZ~bvAformat ňkiϊς݃t@CEbV̏opBTF_RGBA8 ͖k̃~bvj
+	static TextureCookData BuildCookData(const unsigned char* rgba, int width, int height, ETextureFormat format);
+	// fR[hς݂̃sNZGPUɓ]iCXbhŌĂԁj
+	bool Upload();
+
+	// GPU]҂
+	bool IsPendingUpload() const { return m_pixels != nullptr || !m_mips.empty(); }
+	// GPU]҂̃sNZ (RGBAB]Eϊς݃t@Cǂ񂾏ꍇ nullptr)
+	const unsigned char* GetPendingPixels() const { return m_pixels; }
+
+	int GetWidth() const { return m_width; }
+	int GetHeight() const { return m_height; }
+
+	// gp (CPU: ]҂̃sNZE~bv / GPU: ]ς݂̃eNX`BS~bv)
+	size_t GetCpuBytes() const
+	{
+		size_t bytes = m_pixels ? size_t(m_width) * m_height * 4 : 0;
+		for (const TextureMip& mip : m_mips) bytes += mip.size;
+		return bytes;
+	}
+	size_t GetGpuBytes() const { return m_srv ? m_gpuBytes : 0; }
+
 	void SetGPU();
+
+private:
+	// fR[hς݂̃sNZ~bvĈkAϊς݃t@Co
+	bool Cook(const std::string& filename, ETextureFormat format) const;
+	// GPU]҂̂̂̂Ă
+	void ReleasePending();
 };
\ No newline at end of file
@@ -0,0 +1,260 @@
+// ===================================================================
+// TextureFile.cpp
+// ϊς݃eNX` (DDS) ̏oEǂݍ
+// ===================================================================
+#include "TextureFile.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace
+{
+	// DDS ̒萔
+	constexpr uint32_t DDSD_CAPS = 0x1;
+	constexpr uint32_t DDSD_HEIGHT = 0x2;
+	constexpr uint32_t DDSD_WIDTH = 0x4;
+	constexpr uint32_t DDSD_PIXELFORMAT = 0x1000;
+	constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+	constexpr uint32_t DDSD_LINEARSIZE = 0x80000;
+	constexpr uint32_t DDSD_PITCH = 0x8;
+	constexpr uint32_t DDPF_FOURCC = 0x4;
+	constexpr uint32_t DDSCAPS_COMPLEX = 0x8;
+	constexpr uint32_t DDSCAPS_TEXTURE = 0x1000;
+	constexpr uint32_t DDSCAPS_MIPMAP = 0x400000;
+	constexpr uint32_t FourCCDX10 = 0x30315844;		// "DX10"
+
+	// 4x4 ubÑoCg (k 0)
+	uint32_t GetBlockBytes(DXGI_FORMAT format)
+	{
+		switch (format)
+		{
+		case DXGI_FORMAT_BC1_UNORM: return 8;
+		case DXGI_FORMAT_BC3_UNORM: return 16;
+		case DXGI_FORMAT_BC7_UNORM: return 16;
+		default: return 0;
+		}
+	}
+
+	// t@C̑傫EXV擾 ( false)
+	bool GetSourceStamp(const std::string& source, uint64_t& size, int64_t& time)
+	{
+		namespace fs = std::filesystem;
+
+		std::error_code ec;
+		size = fs::file_size(source, ec);
+		if (ec) return false;
+		auto writeTime = fs::last_write_time(source, ec);
+		if (ec) return false;
+		time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+		return true;
+	}
+}
+
+// ===================================================================
+// pX
+// 摜ʂ̌`ŗvĂA݂̕ϊς݃t@C㏑Ȃ悤`t
+// ===================================================================
+std::string TextureFile::GetCookedPath(const std::string& source, ETextureFormat format)
+{
+	static const char* const names[MAX_TEXTUREFORMAT] = { "auto", "rgba8", "bc1", "bc3", "bc7" };
+	const char* name = format >= 0 && format < MAX_TEXTUREFORMAT ? names[format] : "unknown";
+	return source + "." + name + ".dds";
+}
+
+// ===================================================================
+// ~bv̑傫
+// ===================================================================
+uint32_t TextureFile::GetRowPitch(DXGI_FORMAT format, uint32_t width)
+{
+	uint32_t blockBytes = GetBlockBytes(format);
+	if (blockBytes == 0) return width * 4;
+	return std::max(1u, (width + 3) / 4) * blockBytes;
+}
+
+uint32_t TextureFile::GetMipSize(DXGI_FORMAT format, uint32_t width, uint32_t height)
+{
+	uint32_t rows = GetBlockBytes(format) == 0 ? height : std::max(1u, (height + 3) / 4);
+	return GetRowPitch(format, width) * rows;
+}
+
+bool TextureFile::LayoutMips(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount,
+	const uint8_t* data, size_t size, std::vector<TextureMip>& mips)
+{
+	mips.clear();
+	if (width == 0 || height == 0 || mipCount < 1 || mipCount > 16 ||
+		(GetBlockBytes(format) == 0 && format != DXGI_FORMAT_R8G8B8A8_UNORM))
+	{
+		return false;
+	}
+
+	size_t offset = 0;
+	for (uint32_t i = 0; i < mipCount; i++)
+	{
+		TextureMip mip{};
+		mip.width = std::max(1u, width >> i);
+		mip.height = std::max(1u, height >> i);
+		mip.rowPitch = GetRowPitch(format, mip.width);
+		mip.size = GetMipSize(format, mip.width, mip.height);
+		mip.data = data + offset;
+		if (mip.size > size - offset)
+		{
+			mips.clear();
+			return false;
+		}
+		offset += mip.size;
+		mips.push_back(mip);
+	}
+	if (offset != size)
+	{
+		mips.clear();
+		return false;
+	}
+	return true;
+}
+
+// ===================================================================
+// ϊς݃t@CJ
+// ===================================================================
+std::unique_ptr<const TextureFile> TextureFile::Open(const std::string& source, ETextureFormat format)
+{
+	uint64_t sourceSize = 0;
+	int64_t sourceTime = 0;
+	bool hasSource = GetSourceStamp(source, sourceSize, sourceTime);
+
+	auto file = std::make_unique<TextureFile>();
+	if (!file->Map(GetCookedPath(source, format), format, hasSource, sourceSize, sourceTime))
+	{
+		return nullptr;
+	}
+	return file;
+}
+
+// ===================================================================
+// ϊς݃t@Co
+// ===================================================================
+bool TextureFile::Cook(const std::string& source, const TextureCookData& data)
+{
+	if (data.mips.empty() || data.width == 0 || data.height == 0)
+	{
+		return false;
+	}
+
+	TextureFileHeader header{};
+	header.magic = TextureFileHeader::Magic;
+	header.size = 124;
+	header.height = data.height;
+	header.width = data.width;
+	header.depth = 0;
+	header.mipMapCount = static_cast<uint32_t>(data.mips.size());
+
+	const bool compressed = GetBlockBytes(data.dxgiFormat) != 0;
+	header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT |
+		(compressed ? DDSD_LINEARSIZE : DDSD_PITCH);
+	header.pitchOrLinearSize = compressed
+		? GetMipSize(data.dxgiFormat, data.width, data.height)
+		: GetRowPitch(data.dxgiFormat, data.width);
+
+	header.stamp.tag = TextureFileStamp::Tag;
+	header.stamp.version = TextureFileStamp::Version;
+	header.stamp.format = data.format;
+	uint64_t sourceSize = 0;
+	int64_t sourceTime = 0;
+	if (!GetSourceStamp(source, sourceSize, sourceTime))
+	{
+		return false;
+	}
+	header.stamp.sourceSize[0] = static_cast<uint32_t>(sourceSize);
+	header.stamp.sourceSize[1] = static_cast<uint32_t>(sourceSize >> 32);
+	header.stamp.sourceTime[0] = static_cast<uint32_t>(static_cast<uint64_t>(sourceTime));
+	header.stamp.sourceTime[1] = static_cast<uint32_t>(static_cast<uint64_t>(sourceTime) >> 32);
+
+	header.pixelFormat.size = sizeof(TextureFilePixelFormat);
+	header.pixelFormat.flags = DDPF_FOURCC;
+	header.pixelFormat.fourCC = FourCCDX10;
+	header.caps = DDSCAPS_TEXTURE | (data.mips.size() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0);
+
+	header.dxgiFormat = data.dxgiFormat;
+	header.resourceDimension = D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+	header.arraySize = 1;
+
+	// ~bv̑傫mF
+	for (size_t i = 0; i < data.mips.size(); i++)
+	{
+		uint32_t width = std::max(1u, data.width >> i);
+		uint32_t height = std::max(1u, data.height >> i);
+		if (data.mips[i].size() != GetMipSize(data.dxgiFormat, width, height))
+		{
+			return false;
+		}
+	}
+
+	// ꎞt@CɏĂu (̃t@Cǂ܂Ȃ)
+	// eNX`ʃXbhɕϊĂՓ˂Ȃ悤Aꎞt@C̓XbhƂɕς
+	std::string path = GetCookedPath(source, data.format);
+	std::string tempPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out) return false;
+
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		for (const std::vector<uint8_t>& mip : data.mips)
+		{
+			out.write(reinterpret_cast<const char*>(mip.data()), mip.size());
+		}
+
+		if (!out) return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+// ===================================================================
+// }bvĒg؂
+// ===================================================================
+bool TextureFile::Map(const std::string& path, ETextureFormat format, bool hasSource, uint64_t sourceSize, int64_t sourceTime)
+{
+	if (!m_File.Open(path)) return false;
+
+	const std::byte* data = m_File.GetData();
+	size_t size = m_File.GetSize();
+
+	bool valid = size >= sizeof(TextureFileHeader);
+	const TextureFileHeader* header = reinterpret_cast<const TextureFileHeader*>(data);
+	valid = valid &&
+		header->magic == TextureFileHeader::Magic &&
+		header->size == 124 &&
+		header->pixelFormat.fourCC == FourCCDX10 &&
+		header->stamp.tag == TextureFileStamp::Tag &&
+		header->stamp.version == TextureFileStamp::Version &&
+		header->stamp.format == static_cast<uint32_t>(format) &&
+		(!hasSource || (
+			(uint64_t(header->stamp.sourceSize[1]) << 32 | header->stamp.sourceSize[0]) == sourceSize &&
+			static_cast<int64_t>(uint64_t(header->stamp.sourceTime[1]) << 32 | header->stamp.sourceTime[0]) == sourceTime)) &&
+		header->resourceDimension == D3D11_RESOURCE_DIMENSION_TEXTURE2D &&
+		header->arraySize == 1;
+
+	// ~bv̈ʒu߂ (t@C̑傫ƈv邱)
+	valid = valid && LayoutMips(static_cast<DXGI_FORMAT>(header->dxgiFormat), header->width, header->height,
+		header->mipMapCount, reinterpret_cast<const uint8_t*>(data + sizeof(TextureFileHeader)),
+		size - sizeof(TextureFileHeader), m_Mips);
+
+	if (!valid)
+	{
+		m_File.Close();
+		m_Header = nullptr;
+		m_Mips.clear();
+		return false;
+	}
+	m_Header = header;
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+// ===================================================================
+// TextureFile.h
+// ϊς݃eNX` (t@C + ".dds")
+// ~bvSčAubNk (BC1 / BC3 / BC7) ̂ DDS `ŏo
+// t@C̑傫EXVƌ` DDS wb_̗\̈ɋL^AςĂ΍蒼
+// t@CΕϊς݃t@Ĉ܂܎g
+// ǂݍ݂̓}bvāA~bv̂܂ GPU ɓ]
+//
+// t@C\ (ʓI DDS c[łJ)
+//   TextureFileHeader		"DDS " + DDS_HEADER + DDS_HEADER_DXT10
+//   ~bv0, 1, 2 ...		ԂȂŕׂ (k` 4x4 ubNP)
+// ===================================================================
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <d3d11.h>
+
+#include "MappedFile.h"
+
+// ϊς݃eNX`̌`
+enum ETextureFormat {
+	TF_AUTO = 0,							// sȂ BC1AȂ BC3
+	TF_RGBA8,								// kE~bv (ϊȂBtHgEUI ̃AgXp)
+	TF_BC1,									// 4rbg/fBAt@͎̂Ă
+	TF_BC3,									// 8rbg/fBAt@͕ʃubN
+	TF_BC7,									// 8rbg/fBBC3 荂掿 (ϊ͒x)
+	MAX_TEXTUREFORMAT
+};
+
+// ===================================================================
+// t@C̍\ (DDS)
+// ===================================================================
+struct TextureFilePixelFormat
+{
+	uint32_t size;
+	uint32_t flags;
+	uint32_t fourCC;
+	uint32_t rgbBitCount;
+	uint32_t rBitMask;
+	uint32_t gBitMask;
+	uint32_t bBitMask;
+	uint32_t aBitMask;
+};
+
+// ϊ̋L^ (DDS_HEADER ̗\̈ɓ)
+struct TextureFileStamp
+{
+	static constexpr uint32_t Tag = 0x58545746;		// "FWTX"
+	static constexpr uint32_t Version = 1;			// `Eϊ@ςグ (Ât@C͍蒼)
+
+	uint32_t tag;
+	uint32_t version;
+	uint32_t format;			// vꂽ` (ETextureFormatBTF_AUTO ̂܂܋L^)
+	uint32_t sourceSize[2];		// ϊt@C̑傫 (, )
+	uint32_t sourceTime[2];		// ϊt@C̍XV (, )
+	uint32_t reserved[4];
+};
+
+struct TextureFileHeader
+{
+	static constexpr uint32_t Magic = 0x20534444;	// "DDS "
+
+	uint32_t magic;
+	// DDS_HEADER
+	uint32_t size;				// 124
+	uint32_t flags;
+	uint32_t height;
+	uint32_t width;
+	uint32_t pitchOrLinearSize;	// ~bv0 ̃oCg
+	uint32_t depth;
+	uint32_t mipMapCount;
+	TextureFileStamp stamp;		// dwReserved1[11]
+	TextureFilePixelFormat pixelFormat;
+	uint32_t caps;
+	uint32_t caps2;
+	uint32_t caps3;
+	uint32_t caps4;
+	uint32_t reserved2;
+	// DDS_HEADER_DXT10
+	uint32_t dxgiFormat;
+	uint32_t resourceDimension;
+	uint32_t miscFlag;
+	uint32_t arraySize;
+	uint32_t miscFlags2;
+};
+
+// ~bv1 (GPU ɓ]P)
+struct TextureMip
+{
+	const uint8_t* data;
+	uint32_t width;
+	uint32_t height;
+	uint32_t rowPitch;			// 1s (k`̓ubN1s) ̃oCg
+	uint32_t size;
+};
+
+// oe (mips[0] ̑傫)
+struct TextureCookData
+{
+	ETextureFormat format;		// vꂽ` (L^p)
+	DXGI_FORMAT dxgiFormat;		// ۂ̌`
+	uint32_t width;
+	uint32_t height;
+	std::vector<std::vector<uint8_t>> mips;
+};
+
+// ===================================================================
+// TextureFile
+// ===================================================================
+class TextureFile
+{
+private:
+	MappedFile m_File;
+	const TextureFileHeader* m_Header = nullptr;
+	std::vector<TextureMip> m_Mips;
+
+public:
+	// ===================================================================
+	// ǂݍ݁Eo ([J[XbhĂł悢)
+	// ===================================================================
+
+	// ϊς݃t@CJ (Et@CÂE`Ⴄꍇ nullptr)
+	static std::unique_ptr<const TextureFile> Open(const std::string& source, ETextureFormat format);
+	// ϊς݃t@Co
+	static bool Cook(const std::string& source, const TextureCookData& data);
+
+	// pX (`Ƃɕʂ̃t@CB: "a.png.bc7.dds")
+	static std::string GetCookedPath(const std::string& source, ETextureFormat format);
+
+	// ~bv1̃oCgE1s̃oCg (k` 4x4 ubNP)
+	static uint32_t GetRowPitch(DXGI_FORMAT format, uint32_t width);
+	static uint32_t GetMipSize(DXGI_FORMAT format, uint32_t width, uint32_t height);
+	// Aĕ񂾃~bv̈ʒu߂ (ϊς݃bV̓eNX`)
+	// ΉĂȂ`EiA܂͍v size ƈvȂ false
+	static bool LayoutMips(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount,
+		const uint8_t* data, size_t size, std::vector<TextureMip>& mips);
+
+	// ===================================================================
+	// Q (Ԃl͂ TextureFile ĂԂ̂ݗL)
+	// ===================================================================
+	DXGI_FORMAT GetFormat() const { return static_cast<DXGI_FORMAT>(m_Header->dxgiFormat); }
+	uint32_t GetWidth() const { return m_Header->width; }
+	uint32_t GetHeight() const { return m_Header->height; }
+	const std::vector<TextureMip>& GetMips() const { return m_Mips; }
+
+	// ~bv̍voCg
+	size_t GetDataSize() const { return m_File.GetSize() - sizeof(TextureFileHeader); }
+
+private:
+	// }bvĒg؂ (source* ͌t@C̏Bt@CΊmFȂ)
+	bool Map(const std::string& path, ETextureFormat format, bool hasSource, uint64_t sourceSize, int64_t sourceTime);
+};
\ No newline at end of file
@@ -0,0 +1,81 @@
+// ===================================================================
+// ThreadPool.cpp
+// [J[XbhQ̎
+// ===================================================================
+#include "ThreadPool.h"
+#include <iostream>
+
+// ===================================================================
+// 
+// ===================================================================
+void ThreadPool::Init(unsigned int threadCount)
+{
+	if (!m_Workers.empty()) return;
+
+	if (threadCount == 0)
+	{
+		// CXbh̕1c
+		unsigned int cores = std::thread::hardware_concurrency();
+		threadCount = cores > 1 ? cores - 1 : 1;
+	}
+
+	m_Stop = false;
+	m_Workers.reserve(threadCount);
+	for (unsigned int i = 0; i < threadCount; i++)
+	{
+		m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+
+	std::cout << "[ThreadPool] Initialized with " << threadCount << " threads" << std::endl;
+}
+
+// ===================================================================
+// I
+// ===================================================================
+void ThreadPool::UnInit()
+{
+	if (m_Workers.empty()) return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Stop = true;
+	}
+	m_Condition.notify_all();
+
+	for (auto& worker : m_Workers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+	m_Workers.clear();
+
+	std::cout << "[ThreadPool] Uninitialized" << std::endl;
+}
+
+// ===================================================================
+// [J[̏[v
+// ===================================================================
+void ThreadPool::WorkerLoop()
+{
+	while (true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Condition.wait(lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+
+			// IvĂc̃^XN͑SĎs
+			if (m_Stop && m_Tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(m_Tasks.front());
+			m_Tasks.pop_front();
+		}
+
+		task();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+// ===================================================================
+// ThreadPool.h
+// obNOEhp̃[J[XbhQ
+// t@Cǂݍ݁EfR[hCPU𓊂 (GPU̓CXbhōs)
+// ===================================================================
+#pragma once
+#include "singleton.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class ThreadPool
+{
+private:
+	// ===================================================================
+	// oϐ
+	// ===================================================================
+	std::vector<std::thread> m_Workers;			// [J[Xbh
+	std::deque<std::function<void()>> m_Tasks;	// s҂̃^XN
+	std::mutex m_Mutex;							// m_Tasks ̕ی
+	std::condition_variable m_Condition;		// ^XNǉ̒ʒm
+	bool m_Stop = false;						// Iv
+
+public:
+	~ThreadPool() { UnInit(); }
+
+	// ===================================================================
+	// CtTCN
+	// ===================================================================
+
+	// [J[N (0ȂCPŨRA-1)
+	void Init(unsigned int threadCount = 0);
+	// c̃^XNIĂ烏[J[~
+	void UnInit();
+
+	// ===================================================================
+	// ^XN
+	// ===================================================================
+
+	// ֐[J[ŎsAʂ future Ŏ󂯎
+	template<typename F>
+	auto Submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+	{
+		using Result = std::invoke_result_t<std::decay_t<F>>;
+
+		auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+		std::future<Result> future = task->get_future();
+
+		// [J[ꍇ͂̏Ŏs
+		if (m_Workers.empty())
+		{
+			(*task)();
+			return future;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Tasks.emplace_back([task]() { (*task)(); });
+		}
+		m_Condition.notify_one();
+		return future;
+	}
+
+	// [J[
+	size_t GetThreadCount() const { return m_Workers.size(); }
+
+private:
+	// [J[̏[v
+	void WorkerLoop();
+};
+
+// ===================================================================
+// future ̊mF (҂ɒׂ)
+// ===================================================================
+template<typename T>
+bool IsFutureReady(const std::future<T>& future)
+{
+	return future.valid() &&
+		future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+#define THREAD_POOL Singleton<ThreadPool>::GetInstance()
\ No newline at end of file
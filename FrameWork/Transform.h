@@ -3,12 +3,16 @@
 // GameObject̎pǗNX
 // ===================================================================
 #pragma once
+#include <vector>
+#include <algorithm>
 #include <SimpleMath.h>
 #include "SystemCommon.h"
+#include "TransformBatch.h"
 
 // ===================================================================
 // Transform NX
-// GameObjectpNX
+// GameObjectpNX
+// eq֌WA[JsE[hsLbV
 // ===================================================================
 class Transform
 {
@@ -17,13 +21,17 @@ private:
     // oϐ
     // ===================================================================
 
-    // [hW(x,y,z)
+    // [JW(x,y,z) eꍇ̓[hW
     Vector3 m_Position = Vector3(0.0f, 0.0f, 0.0f);
-    // ]px(Eulerp (Pitch, Yaw, Roll))
-    Vector3 m_Rotation = Vector3(0.0f, 0.0f, 0.0f);
+    // ](NH[^jI)
+    Quaternion m_Rotation = Quaternion::Identity;
     // XP[(z,y,z)
     Vector3 m_Scale = Vector3(1.0f, 1.0f, 1.0f);
 
+    // ]px(Eulerp (Pitch, Yaw, Roll)) xmlEGfB^pBKvɂȂɎZo
+    mutable Vector3 m_EulerAngles = Vector3(0.0f, 0.0f, 0.0f);
+    mutable bool m_EulerDirty = false;
+
     // [hW(x,y,z) l
     Vector3 m_PositionInit = Vector3(0.0f, 0.0f, 0.0f);
     // ]px(Eulerp (Pitch, Yaw, Roll))@l
@@ -31,13 +39,29 @@ private:
     // XP[(z,y,z)@l
     Vector3 m_ScaleInit = Vector3(1.0f, 1.0f, 1.0f);
 
+    // ===================================================================
+    // Kw\
+    // ===================================================================
+    Transform* m_pParent = nullptr;         // eTransforminullptrj
+    std::vector<Transform*> m_Children;     // qTransformꗗ
+
+    // ===================================================================
+    // sLbV
+    // ===================================================================
+    mutable Matrix m_LocalMatrix;           // [Js (S * R * T)
+    mutable Matrix m_WorldMatrix;           // [hs (Local * ParentWorld)
+    mutable bool m_LocalDirty = true;       // [Js̍ČvZKv
+    mutable bool m_WorldDirty = true;       // [hs̍ČvZKv
+    mutable bool m_ChildDirty = false;      // qɃ[hs̍ČvZKvȂ̂邩
+    mutable bool m_BoundsDirty = true;      // ԃCfbNX̋E{bNX̍XVKv
+
 public:
     // ===================================================================
-    // RXgN^
+    // RXgN^EfXgN^
     // ===================================================================
     Transform()
         : m_Position(0.0f, 0.0f, 0.0f)
-        , m_Rotation(0.0f, 0.0f, 0.0f)
+        , m_Rotation(Quaternion::Identity)
         , m_Scale(1.0f, 1.0f, 1.0f){}
     Transform(Vector3 pos, Vector3 rotate, Vector3 scale)
         : m_PositionInit(pos)
@@ -45,22 +69,64 @@ public:
         , m_ScaleInit(scale)
     {
         m_Position = m_PositionInit;
-        m_Rotation = m_RotationInit;
+        m_Rotation = EulerToQuaternion(m_RotationInit);
+        m_EulerAngles = m_RotationInit;
         m_Scale = m_ScaleInit;
     }
 
+    ~Transform()
+    {
+        // eq֌Wi_OO|C^cȂj
+        SetParent(nullptr);
+        for (Transform* child : m_Children)
+        {
+            child->m_pParent = nullptr;
+            child->MarkWorldDirty();
+        }
+        m_Children.clear();
+    }
+
+    // eq֌W|C^Ŏ߃Rs[֎~
+    Transform(const Transform&) = delete;
+    Transform& operator=(const Transform&) = delete;
+
     // ===================================================================
     // Set֐
     // ===================================================================
-    void SetPosition(const Vector3& pos) { m_Position = pos; }
-    void SetRotation(const Vector3& rot) { m_Rotation = rot; }
-    void SetScale(const Vector3& scale) { m_Scale = scale; }
+    void SetPosition(const Vector3& pos) { m_Position = pos; MarkLocalDirty(); }
+    // EulerpŐݒixmľ`j
+    void SetRotation(const Vector3& rot)
+    {
+        m_Rotation = EulerToQuaternion(rot);
+        m_EulerAngles = rot;
+        m_EulerDirty = false;
+        MarkLocalDirty();
+    }
+    // NH[^jIŐݒ
+    void SetRotation(const Quaternion& rot)
+    {
+        m_Rotation = rot;
+        m_Rotation.Normalize();
+        m_EulerDirty = true;
+        MarkLocalDirty();
+    }
+    void SetScale(const Vector3& scale) { m_Scale = scale; MarkLocalDirty(); }
 
     // ===================================================================
     // Get֐
     // ===================================================================
     const Vector3& GetPosition() const { return m_Position; }
-    const Vector3& GetRotation() const { return m_Rotation; }
+    // EulerpŎ擾iNH[^jIŐݒ肳ꂽꍇ͂ŕϊj
+    const Vector3& GetRotation() const
+    {
+        if (m_EulerDirty)
+        {
+            m_EulerAngles = m_Rotation.ToEuler();
+            m_EulerDirty = false;
+        }
+        return m_EulerAngles;
+    }
+    const Quaternion& GetRotationQuaternion() const { return m_Rotation; }
     const Vector3& GetScale() const { return m_Scale; }
     void ConvertData(float* pos, float* rot, float* scale)
     {
@@ -68,34 +134,145 @@ public:
         pos[1] = m_Position.y;
         pos[2] = m_Position.z;
 
-        rot[0] = m_Rotation.x;
-        rot[1] = m_Rotation.y;
-        rot[2] = m_Rotation.z;
+        const Vector3& euler = GetRotation();
+        rot[0] = euler.x;
+        rot[1] = euler.y;
+        rot[2] = euler.z;
 
         scale[0] = m_Scale.x;
         scale[1] = m_Scale.y;
         scale[2] = m_Scale.z;
     }
 
+    // [hW擾
+    Vector3 GetWorldPosition() const { return GetWorldMatrix().Translation(); }
+
+    // ===================================================================
+    // eq֌W
+    // ===================================================================
+
+    // eݒ (nullptrŐeq֌W)
+    // keepWorld = true ̏ꍇÃ݂[hpۂ悤Ƀ[Jl␳
+    void SetParent(Transform* parent, bool keepWorld = false)
+    {
+        if (parent == m_pParent || parent == this) return;
+
+        // zQƃ`FbNi̎qeɂ͂łȂj
+        for (Transform* p = parent; p != nullptr; p = p->m_pParent)
+        {
+            if (p == this) return;
+        }
+
+        Matrix world;
+        if (keepWorld) world = GetWorldMatrix();
+
+        // eO
+        if (m_pParent)
+        {
+            auto& siblings = m_pParent->m_Children;
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+        }
+
+        // Veɓo^
+        m_pParent = parent;
+        if (m_pParent)
+        {
+            m_pParent->m_Children.push_back(this);
+        }
+
+        // [hpێꍇ̓[JltZ
+        if (keepWorld)
+        {
+            Matrix local = m_pParent ? world * m_pParent->GetWorldMatrix().Invert() : world;
+
+            Vector3 scale, translation;
+            Quaternion rotation;
+            if (local.Decompose(scale, rotation, translation))
+            {
+                m_Position = translation;
+                m_Rotation = rotation;
+                m_EulerDirty = true;
+                m_Scale = scale;
+            }
+        }
+
+        MarkLocalDirty();
+        NotifyParentDirty();
+    }
+
+    Transform* GetParent() const { return m_pParent; }
+    const std::vector<Transform*>& GetChildren() const { return m_Children; }
+
     // ===================================================================
     // [hšvZ
     // ===================================================================
-    Matrix GetWorldMatrix() const
+
+    // [Js擾 (ύX̂ݍČvZ)
+    const Matrix& GetLocalMatrix() const
     {
-        // Scalesigkϊj
-        Matrix s = Matrix::CreateScale(m_Scale);
-        // Rotationsi]ϊj
-        Matrix r = Matrix::CreateFromYawPitchRoll(
-            m_Rotation.y,  // Yaw   (Y])
-            m_Rotation.x,  // Pitch (X])
-            m_Rotation.z   // Roll  (Z])
-        );
+        if (m_LocalDirty)
+        {
+            UpdateLocalMatrix();
+        }
+        return m_LocalMatrix;
+    }
+
+    // [hs擾 (ύX̂ݍČvZ)
+    const Matrix& GetWorldMatrix() const
+    {
+        if (m_WorldDirty)
+        {
+            UpdateWorldMatrix();
+        }
+        return m_WorldMatrix;
+    }
 
-        // Translationsisړϊj
-        Matrix t = Matrix::CreateTranslation(m_Position);
+    // [Js̍ČvZKv
+    bool IsLocalDirty() const { return m_LocalDirty; }
 
-        // : S * R * T
-        return s * r * t;
+    // ꊇvZ[Js߂ (TransformBatch ɂꊇXVp)
+    void SetCachedLocalMatrix(const Matrix& local) const
+    {
+        m_LocalMatrix = local;
+        m_LocalDirty = false;
+    }
+
+    // ̊KwȉōČvZKv
+    bool IsHierarchyDirty() const { return m_WorldDirty || m_ChildDirty; }
+
+    // ԃCfbNX̋E{bNX𖳌ɂ ([hs̕ω͎ŗ)
+    void MarkBoundsDirty() const { m_BoundsDirty = true; }
+    // E{bNX̍XVKvȂ true ԂătO낷 (SceneBase t[Ă)
+    bool ConsumeBoundsDirty() const
+    {
+        bool dirty = m_BoundsDirty;
+        m_BoundsDirty = false;
+        return dirty;
+    }
+
+    // Kwȉ̕ύXTransform̃[hs܂Ƃ߂čXV
+    // ([gTransformɑ΂Ėt[1ĂԁBύX̖؂͒HȂ)
+    void UpdateHierarchy() const
+    {
+        // gXVꂽꍇ͎q_[eBɂȂĂ
+        bool visitChildren = m_WorldDirty || m_ChildDirty;
+
+        if (m_WorldDirty)
+        {
+            UpdateWorldMatrix();
+        }
+        m_ChildDirty = false;
+
+        if (visitChildren)
+        {
+            for (const Transform* child : m_Children)
+            {
+                if (child->IsHierarchyDirty())
+                {
+                    child->UpdateHierarchy();
+                }
+            }
+        }
     }
 
     // ===================================================================
@@ -106,43 +283,57 @@ public:
     void Translate(const Vector3& delta)
     {
         m_Position += delta;
+        MarkLocalDirty();
     }
 
-    // w肵ʂ]
+    // w肵ʂ] (EulerpɉZ)
     void Rotate(const Vector3& delta)
     {
-        m_Rotation += delta;
+        SetRotation(GetRotation() + delta);
+    }
+
+    // ݂̉]̌ delta ̉]Kp (WobNȂ)
+    void Rotate(const Quaternion& delta)
+    {
+        SetRotation(m_Rotation * delta);
     }
 
     // w肵ʂXP[ύX
     void Scale(const Vector3& delta)
     {
         m_Scale += delta;
+        MarkLocalDirty();
     }
 
     // ===================================================================
-    // [JxNg̎擾
+    // [hxNg̎擾 (LbVς݂̃[hs񂩂o)
     // ===================================================================
 
     // OxNg (Z)
     Vector3 GetForward() const
     {
-        Matrix r = Matrix::CreateFromYawPitchRoll(m_Rotation.y, m_Rotation.x, m_Rotation.z);
-        return Vector3(r._31, r._32, r._33);
+        const Matrix& w = GetWorldMatrix();
+        Vector3 v(w._31, w._32, w._33);
+        v.Normalize();
+        return v;
     }
 
     // xNg (Y)
     Vector3 GetUp() const
     {
-        Matrix r = Matrix::CreateFromYawPitchRoll(m_Rotation.y, m_Rotation.x, m_Rotation.z);
-        return Vector3(r._21, r._22, r._23);
+        const Matrix& w = GetWorldMatrix();
+        Vector3 v(w._21, w._22, w._23);
+        v.Normalize();
+        return v;
     }
 
     // ExNg (X)
     Vector3 GetRight() const
     {
-        Matrix r = Matrix::CreateFromYawPitchRoll(m_Rotation.y, m_Rotation.x, m_Rotation.z);
-        return Vector3(r._11, r._12, r._13);
+        const Matrix& w = GetWorldMatrix();
+        Vector3 v(w._11, w._12, w._13);
+        v.Normalize();
+        return v;
     }
 
     // ===================================================================
@@ -151,7 +342,85 @@ public:
     void Reset()
     {
         m_Position = m_PositionInit;
-        m_Rotation = m_RotationInit;
         m_Scale = m_ScaleInit;
+        SetRotation(m_RotationInit);
+    }
+
+    // luăZbgiXe[W̍ēǂݍݗpBlȂ牽Ȃj
+    bool SetInitialState(const Vector3& pos, const Vector3& rot, const Vector3& scale)
+    {
+        if (pos == m_PositionInit && rot == m_RotationInit && scale == m_ScaleInit) return false;
+
+        m_PositionInit = pos;
+        m_RotationInit = rot;
+        m_ScaleInit = scale;
+        Reset();
+        return true;
+    }
+
+private:
+    // ===================================================================
+    // _[eBtOǗ
+    // ===================================================================
+
+    // [Jlς
+    void MarkLocalDirty()
+    {
+        m_LocalDirty = true;
+        MarkWorldDirty();
+    }
+
+    // [hs񂪖ɂȂ (qɂ`d)
+    void MarkWorldDirty()
+    {
+        // Ƀ_[eBȂq_[eBȂ̂ŒHȂ
+        if (m_WorldDirty) return;
+
+        m_WorldDirty = true;
+        m_BoundsDirty = true;
+        for (Transform* child : m_Children)
+        {
+            child->MarkWorldDirty();
+        }
+
+        NotifyParentDirty();
+    }
+
+    // eɁuqɕύXv`
+    void NotifyParentDirty()
+    {
+        for (Transform* p = m_pParent; p != nullptr && !p->m_ChildDirty; p = p->m_pParent)
+        {
+            p->m_ChildDirty = true;
+        }
+    }
+
+    // ===================================================================
+    // s̍ČvZ
+    // ===================================================================
+    void UpdateLocalMatrix() const
+    {
+        // : S * R * T (NH[^jI璼ڑgݗĂ̂ŎOp֐͕sv)
+        TransformBatch::Compose(m_Position, m_Rotation, m_Scale, m_LocalMatrix);
+        m_LocalDirty = false;
+    }
+
+    // Eulerp (Pitch, Yaw, Roll)  NH[^jI
+    static Quaternion EulerToQuaternion(const Vector3& euler)
+    {
+        return Quaternion::CreateFromYawPitchRoll(
+            euler.y,  // Yaw   (Y])
+            euler.x,  // Pitch (X])
+            euler.z   // Roll  (Z])
+        );
+    }
+
+    void UpdateWorldMatrix() const
+    {
+        const Matrix& local = GetLocalMatrix();
+
+        // eΐẽ[hs| (eɍXV)
+        m_WorldMatrix = m_pParent ? local * m_pParent->GetWorldMatrix() : local;
+        m_WorldDirty = false;
     }
 };
\ No newline at end of file
@@ -0,0 +1,130 @@
+// ===================================================================
+// TransformBatch.cpp
+// [hs̈ꊇ̎
+// ===================================================================
+#include "TransformBatch.h"
+
+#if defined(_XM_SSE_INTRINSICS_)
+#include <xmmintrin.h>
+#endif
+
+namespace TransformBatch
+{
+	// ===================================================================
+	// 1̍s𐶐
+	// ===================================================================
+	void Compose(const Vector3& p, const Quaternion& q, const Vector3& s, Matrix& out)
+	{
+		const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		// ]s̊esɃXP[| (S * R)
+		out._11 = (1.0f - 2.0f * (yy + zz)) * s.x;
+		out._12 = (2.0f * (xy + wz)) * s.x;
+		out._13 = (2.0f * (xz - wy)) * s.x;
+		out._14 = 0.0f;
+
+		out._21 = (2.0f * (xy - wz)) * s.y;
+		out._22 = (1.0f - 2.0f * (xx + zz)) * s.y;
+		out._23 = (2.0f * (yz + wx)) * s.y;
+		out._24 = 0.0f;
+
+		out._31 = (2.0f * (xz + wy)) * s.z;
+		out._32 = (2.0f * (yz - wx)) * s.z;
+		out._33 = (1.0f - 2.0f * (xx + yy)) * s.z;
+		out._34 = 0.0f;
+
+		// sړ (* T)
+		out._41 = p.x;
+		out._42 = p.y;
+		out._43 = p.z;
+		out._44 = 1.0f;
+	}
+
+	// ===================================================================
+	// ܂Ƃ߂čs𐶐
+	// ===================================================================
+	void BuildWorldMatrices(const Vector3* positions, const Quaternion* rotations, const Vector3* scales, Matrix* out, size_t count)
+	{
+		size_t i = 0;
+
+#if defined(_XM_SSE_INTRINSICS_)
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		const __m128 zero = _mm_setzero_ps();
+
+		// 4 SoA ɕבւČvZ
+		for (; i + 4 <= count; i += 4)
+		{
+			// NH[^jI4ǂݍ݁Ax/y/z/w Ƃɓ]u
+			__m128 qx = _mm_loadu_ps(&rotations[i + 0].x);
+			__m128 qy = _mm_loadu_ps(&rotations[i + 1].x);
+			__m128 qz = _mm_loadu_ps(&rotations[i + 2].x);
+			__m128 qw = _mm_loadu_ps(&rotations[i + 3].x);
+			_MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+
+			// XP[Eʒu (Vector312oCg݂Ȃ̂Ōʂɋl߂)
+			const __m128 sx = _mm_setr_ps(scales[i].x, scales[i + 1].x, scales[i + 2].x, scales[i + 3].x);
+			const __m128 sy = _mm_setr_ps(scales[i].y, scales[i + 1].y, scales[i + 2].y, scales[i + 3].y);
+			const __m128 sz = _mm_setr_ps(scales[i].z, scales[i + 1].z, scales[i + 2].z, scales[i + 3].z);
+
+			__m128 px = _mm_setr_ps(positions[i].x, positions[i + 1].x, positions[i + 2].x, positions[i + 3].x);
+			__m128 py = _mm_setr_ps(positions[i].y, positions[i + 1].y, positions[i + 2].y, positions[i + 3].y);
+			__m128 pz = _mm_setr_ps(positions[i].z, positions[i + 1].z, positions[i + 2].z, positions[i + 3].z);
+			__m128 pw = one;
+
+			// 2̍
+			const __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+			const __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+			const __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+			// 1s (X) * sx
+			__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+			__m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+			__m128 m13 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+			__m128 m14 = zero;
+
+			// 2s (Y) * sy
+			__m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+			__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+			__m128 m23 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+			__m128 m24 = zero;
+
+			// 3s (Z) * sz
+			__m128 m31 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+			__m128 m32 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+			__m128 m33 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+			__m128 m34 = zero;
+
+			// SoA  AoS ɖ߂čsƂɏo
+			_MM_TRANSPOSE4_PS(m11, m12, m13, m14);
+			_MM_TRANSPOSE4_PS(m21, m22, m23, m24);
+			_MM_TRANSPOSE4_PS(m31, m32, m33, m34);
+			_MM_TRANSPOSE4_PS(px, py, pz, pw);
+
+			const __m128 rows[4][4] =
+			{
+				{ m11, m21, m31, px },
+				{ m12, m22, m32, py },
+				{ m13, m23, m33, pz },
+				{ m14, m24, m34, pw },
+			};
+			for (int k = 0; k < 4; k++)
+			{
+				float* dst = &out[i + k]._11;
+				_mm_storeu_ps(dst + 0, rows[k][0]);
+				_mm_storeu_ps(dst + 4, rows[k][1]);
+				_mm_storeu_ps(dst + 8, rows[k][2]);
+				_mm_storeu_ps(dst + 12, rows[k][3]);
+			}
+		}
+#endif
+
+		// [i܂SIMDΉj1
+		for (; i < count; i++)
+		{
+			Compose(positions[i], rotations[i], scales[i], out[i]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+// ===================================================================
+// TransformBatch.h
+// ʒuE](NH[^jI)EXP[烏[hs܂Ƃ߂Đ
+// ===================================================================
+#pragma once
+#include <cstddef>
+#include "SystemCommon.h"
+
+namespace TransformBatch
+{
+	// ===================================================================
+	// 1̍s𐶐 (S * R * T)
+	// Op֐g킸NH[^jI璼ڑgݗĂ
+	// ===================================================================
+	void Compose(const Vector3& position, const Quaternion& rotation, const Vector3& scale, Matrix& out);
+
+	// ===================================================================
+	// ܂Ƃ߂čs𐶐 (S * R * T)
+	// l߂ĕׂz󂯎ASIMD4
+	//  out  count mۍς݂ł邱
+	// ===================================================================
+	void BuildWorldMatrices(
+		const Vector3* positions,	// ʒuz
+		const Quaternion* rotations,	// ]ziKς݁j
+		const Vector3* scales,		// XP[z
+		Matrix* out,				// o͐
+		size_t count);				// 
+}
\ No newline at end of file
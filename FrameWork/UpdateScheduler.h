@@ -0,0 +1,85 @@
+// ===================================================================
+// UpdateScheduler.h
+// J̋ɉăR|[lg̍XVpx (Update LOD)
+// ԈꂽXV GameObject ƂɈʑ炵Aet[ɋϓɐU蕪
+// ===================================================================
+#pragma once
+#include <cstdint>
+
+#include "SystemCommon.h"
+
+// ===================================================================
+// XVpx̎w (Component )
+// ===================================================================
+enum class UpdateRate
+{
+	EveryFrame,		// t[XV (́EJEȂ)
+	DistanceBased,	// J̋ɉĊԈ
+};
+
+// ===================================================================
+// XVpx̒iK (Ō܂)
+// ===================================================================
+enum class UpdateTier
+{
+	Full,		// t[
+	Half,		// 2t[1
+	Quarter,	// 4t[1
+	Eighth,		// 8t[1
+
+	Count,
+};
+
+// ===================================================================
+// UpdateScheduler
+// ===================================================================
+class UpdateScheduler
+{
+private:
+	// eiKɓ鋗 (Half, Quarter, Eighth ̏B艓Ƃ̒iKɂȂ)
+	float m_TierDistances[static_cast<int>(UpdateTier::Count) - 1] = { 50.0f, 100.0f, 200.0f };
+
+	uint32_t m_Frame = 0;		// t[ԍ
+	uint32_t m_NextPhase = 0;	// Ɋ蓖Ăʑ
+
+public:
+	// t[̊Jn (SceneBase::UpdateObjectList ̐擪ŌĂ)
+	void BeginFrame() { m_Frame++; }
+
+	// eiKɓ鋗ݒ
+	void SetTierDistances(float half, float quarter, float eighth)
+	{
+		m_TierDistances[0] = half;
+		m_TierDistances[1] = quarter;
+		m_TierDistances[2] = eighth;
+	}
+
+	// ʒuƎ_iK߂
+	UpdateTier GetTier(const Vector3& position, const Vector3& viewer) const
+	{
+		float dx = position.x - viewer.x;
+		float dy = position.y - viewer.y;
+		float dz = position.z - viewer.z;
+		float distanceSq = dx * dx + dy * dy + dz * dz;
+
+		int tier = 0;
+		while (tier < static_cast<int>(UpdateTier::Count) - 1 &&
+			distanceSq > m_TierDistances[tier] * m_TierDistances[tier])
+		{
+			tier++;
+		}
+		return static_cast<UpdateTier>(tier);
+	}
+
+	// iKƂ̍XVԊu (t[)
+	static uint32_t GetInterval(UpdateTier tier) { return 1u << static_cast<uint32_t>(tier); }
+
+	// ʑ蓖Ă (AԂȂ̂œiK GameObject et[ɋϓɎU΂)
+	uint32_t AssignPhase() { return m_NextPhase++; }
+
+	// ̃t[ōXV邩
+	bool IsDue(UpdateTier tier, uint32_t phase) const
+	{
+		return ((m_Frame + phase) & (GetInterval(tier) - 1)) == 0;
+	}
+};
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include	<span>
 #include	<vector>
 #include	<wrl/client.h>
 #include	"renderer.h"
@@ -13,7 +14,8 @@ template <typename T> class VertexBuffer{
 	ComPtr<ID3D11Buffer> m_VertexBuffer;
 
 public:
-	void Create(const std::vector<T>& vertices)
+	// vertices  vector łAϊς݃t@C (MeshFile) ̃}bv̈ł悢
+	void Create(std::span<const T> vertices)
 	{
 		// foCX擾
 		ID3D11Device* device = nullptr;
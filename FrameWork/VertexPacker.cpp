@@ -0,0 +1,145 @@
+// ===================================================================
+// VertexPacker.cpp
+// _̈kE
+// ===================================================================
+#include "VertexPacker.h"
+
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+
+namespace VertexPacker
+{
+	namespace
+	{
+		using DirectX::SimpleMath::Vector2;
+		using DirectX::SimpleMath::Vector3;
+
+		// 0`1  UNORM 
+		uint32_t ToUnorm(float value, uint32_t maxValue)
+		{
+			return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * maxValue));
+		}
+
+		// -1`1  SNORM16 
+		int16_t ToSnorm16(float value)
+		{
+			return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+		}
+
+		float SignNotZero(float value)
+		{
+			return value >= 0.0f ? 1.0f : -1.0f;
+		}
+
+		// ===================================================================
+		// ʑ̂ւ̓WJ
+		// Pʋ𔪖ʑ (|x|+|y|+|z| = 1) ɎˉeAɐ܂ԂĐ`ɕׂ
+		// ===================================================================
+		Vector2 EncodeOctahedral(Vector3 n)
+		{
+			float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+			if (sum <= 0.0f) return Vector2(0.0f, 0.0f);	// @Ȃ +Z 
+			n /= sum;
+			if (n.z < 0.0f)
+			{
+				return Vector2(
+					(1.0f - std::abs(n.y)) * SignNotZero(n.x),
+					(1.0f - std::abs(n.x)) * SignNotZero(n.y));
+			}
+			return Vector2(n.x, n.y);
+		}
+
+		Vector3 DecodeOctahedral(const Vector2& e)
+		{
+			Vector3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+			float t = std::max(-n.z, 0.0f);
+			n.x += n.x >= 0.0f ? -t : t;
+			n.y += n.y >= 0.0f ? -t : t;
+			n.Normalize();
+			return n;
+		}
+	}
+
+	// ===================================================================
+	// k
+	// ===================================================================
+	void Pack(std::span<const VERTEX_3D> vertices, const Bounds& bounds, std::vector<VERTEX_PACKED>& packed)
+	{
+		packed.resize(vertices.size());
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			packed[i] = Pack(vertices[i], bounds);
+		}
+	}
+
+	VERTEX_PACKED Pack(const VERTEX_3D& vertex, const Bounds& bounds)
+	{
+		VERTEX_PACKED packed{};
+
+		// ʒu (傫 0 ͍̎ŏ_̂܂)
+		const Vector3 size = bounds.max - bounds.min;
+		const float position[3] = { vertex.position.x, vertex.position.y, vertex.position.z };
+		const float minimum[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+		const float extent[3] = { size.x, size.y, size.z };
+		for (int k = 0; k < 3; k++)
+		{
+			float t = extent[k] > 0.0f ? (position[k] - minimum[k]) / extent[k] : 0.0f;
+			packed.position[k] = static_cast<uint16_t>(ToUnorm(t, 0xFFFF));
+		}
+		packed.position[3] = 0xFFFF;
+
+		Vector2 normal = EncodeOctahedral(vertex.normal);
+		packed.normal[0] = ToSnorm16(normal.x);
+		packed.normal[1] = ToSnorm16(normal.y);
+
+		packed.color[0] = static_cast<uint8_t>(ToUnorm(vertex.color.x, 0xFF));
+		packed.color[1] = static_cast<uint8_t>(ToUnorm(vertex.color.y, 0xFF));
+		packed.color[2] = static_cast<uint8_t>(ToUnorm(vertex.color.z, 0xFF));
+		packed.color[3] = static_cast<uint8_t>(ToUnorm(vertex.color.w, 0xFF));
+
+		packed.uv[0] = DirectX::PackedVector::XMConvertFloatToHalf(vertex.uv.x);
+		packed.uv[1] = DirectX::PackedVector::XMConvertFloatToHalf(vertex.uv.y);
+		return packed;
+	}
+
+	// ===================================================================
+	//  (VF[_[ƓvZ)
+	// ===================================================================
+	VERTEX_3D Unpack(const VERTEX_PACKED& vertex, const Bounds& bounds)
+	{
+		VERTEX_3D unpacked{};
+
+		const Vector3 size = bounds.max - bounds.min;
+		unpacked.position = bounds.min + Vector3(
+			vertex.position[0] / 65535.0f * size.x,
+			vertex.position[1] / 65535.0f * size.y,
+			vertex.position[2] / 65535.0f * size.z);
+
+		// SNORM  -32768  -1 ƂĈ
+		unpacked.normal = DecodeOctahedral(Vector2(
+			std::max(vertex.normal[0] / 32767.0f, -1.0f),
+			std::max(vertex.normal[1] / 32767.0f, -1.0f)));
+
+		unpacked.color = DirectX::SimpleMath::Color(
+			vertex.color[0] / 255.0f, vertex.color[1] / 255.0f,
+			vertex.color[2] / 255.0f, vertex.color[3] / 255.0f);
+
+		unpacked.uv = Vector2(
+			DirectX::PackedVector::XMConvertHalfToFloat(vertex.uv[0]),
+			DirectX::PackedVector::XMConvertHalfToFloat(vertex.uv[1]));
+		return unpacked;
+	}
+
+	// ===================================================================
+	// 
+	// ===================================================================
+	QUANTIZATION GetQuantization(const Bounds& bounds)
+	{
+		const Vector3 size = bounds.max - bounds.min;
+		QUANTIZATION quantization{};
+		quantization.PositionOffset = DirectX::SimpleMath::Vector4(bounds.min.x, bounds.min.y, bounds.min.z, 0.0f);
+		quantization.PositionScale = DirectX::SimpleMath::Vector4(size.x, size.y, size.z, 0.0f);
+		return quantization;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+// ===================================================================
+// VertexPacker.h
+// VERTEX_3D (48oCg)  VERTEX_PACKED (20oCg) ̕ϊ
+//   ʒu     : E{bNX̊ UNORM16  (덷͋E{bNX 1/65535)
+//   @     : ʑ̂ɓWJ SNORM16 x2 
+//   J[   : UNORM8  (0`1 Ɋۂ߂)
+//   UV       : x
+// ̓VF[_[ (common.hlsl  DecodePackedVertex) ōsBUnpack ͓vZ CPU 
+// ===================================================================
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Bounds.h"
+#include "renderer.h"
+
+namespace VertexPacker
+{
+	// k (bounds ͑SĂ̒_܂ނ́B`掞 bounds ŕ)
+	void Pack(std::span<const VERTEX_3D> vertices, const Bounds& bounds, std::vector<VERTEX_PACKED>& packed);
+	VERTEX_PACKED Pack(const VERTEX_3D& vertex, const Bounds& bounds);
+
+	// 
+	VERTEX_3D Unpack(const VERTEX_PACKED& vertex, const Bounds& bounds);
+
+	// VF[_[ɓn (Renderer::SetQuantization)
+	QUANTIZATION GetQuantization(const Bounds& bounds);
+}
\ No newline at end of file
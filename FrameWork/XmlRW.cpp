@@ -1,19 +1,19 @@
 #include "XmlRW.h"
 
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include "download/tinyxml2.h"
 
 using namespace tinyxml2;
 
-//float GetFloatAttribute(XMLElement* elem, const char* attrName, float defaultValue = 0.0f);
-float GetFloatAttribute(XMLElement* elem, const char* attrName, float defaultValue = 0.0f)
-{
-    const char* attr = elem->Attribute(attrName);
-    if (attr) return static_cast<float>(atof(attr));
-    return defaultValue;
-}
-
 std::string compose_file_name(const char* _stage)
 {
     std::string xmlFile = "data/";
@@ -22,101 +22,427 @@ std::string compose_file_name(const char* _stage)
     return xmlFile;
 }
 
-int XmlRW::GetObjectData(const char* _stage, std::vector<ObjectData>& _objectList)
+namespace
 {
-    XMLDocument doc;
-    if (doc.LoadFile(compose_file_name(_stage).c_str()) != XML_SUCCESS) {
-        std::cout << "Failed to load XML\n";
-        return -1;
+    // ----------------------------------------
+    // l̕ϊ (atof ƈႢP[ɈˑAmۂȂ)
+    // ----------------------------------------
+    std::string_view TrimSpace(std::string_view text)
+    {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t' || text.front() == '\r' || text.front() == '\n')) text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r' || text.back() == '\n')) text.remove_suffix(1);
+        if (!text.empty() && text.front() == '+') text.remove_prefix(1);
+        return text;
     }
 
-    XMLElement* root = doc.FirstChildElement("Objects");
-    if (!root) {
-        std::cout << "No <Objects> element!\n";
-        return -1;
+    template <typename T>
+    T ParseNumber(std::string_view text, T defaultValue)
+    {
+        text = TrimSpace(text);
+        T value{};
+        auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        return result.ec == std::errc() ? value : defaultValue;
     }
 
-    for (XMLElement* elem = root->FirstChildElement("Object"); elem != nullptr; elem = elem->NextSiblingElement("Object"))
+    // ----------------------------------------
+    // QƂ̓WJ (&amp; &lt; &gt; &quot; &apos; &#N; &#xN;)
+    // ----------------------------------------
+    void AppendUtf8(std::string& out, uint32_t code)
     {
-        ObjectData data;
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        }
+        else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+        else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+        else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    void DecodeEntities(std::string_view text, std::string& out)
+    {
+        out.clear();
+        size_t amp = text.find('&');
+        if (amp == std::string_view::npos) {
+            out.assign(text);
+            return;
+        }
+
+        while (amp != std::string_view::npos)
+        {
+            out.append(text.substr(0, amp));
+            text.remove_prefix(amp);
+
+            size_t semi = text.find(';');
+            std::string_view entity = semi != std::string_view::npos ? text.substr(1, semi - 1) : std::string_view();
+            uint32_t code = 0;
+            if (entity == "amp") out.push_back('&');
+            else if (entity == "lt") out.push_back('<');
+            else if (entity == "gt") out.push_back('>');
+            else if (entity == "quot") out.push_back('"');
+            else if (entity == "apos") out.push_back('\'');
+            else if (entity.size() > 2 && entity[0] == '#' && (entity[1] == 'x' || entity[1] == 'X') &&
+                std::from_chars(entity.data() + 2, entity.data() + entity.size(), code, 16).ec == std::errc()) AppendUtf8(out, code);
+            else if (entity.size() > 1 && entity[0] == '#' &&
+                std::from_chars(entity.data() + 1, entity.data() + entity.size(), code).ec == std::errc()) AppendUtf8(out, code);
+            else {
+                // m̎QƂ͂̂܂܎c
+                out.push_back('&');
+                text.remove_prefix(1);
+                amp = text.find('&');
+                continue;
+            }
+
+            text.remove_prefix(semi + 1);
+            amp = text.find('&');
+        }
+        out.append(text);
+    }
 
+    // ----------------------------------------
+    //  ObjectData ɔf
+    // ----------------------------------------
+    void ResetObjectData(ObjectData& data)
+    {
+        //  clear ̂ (mۍς݂̗̈ Object Ŏg)
+        data.id = 0;
+        data.objectName.clear();
+        data.objectType.clear();
+        data.objectTag.clear();
+        data.fileName.clear();
+        data.texture.clear();
+        for (float& v : data.pos) v = 0.0f;
+        for (float& v : data.rot) v = 0.0f;
+        for (float& v : data.scl) v = 1.0f;
+        for (float& v : data.color) v = 1.0f;
+        data.components.clear();
+    }
+
+    void SetObjectAttribute(ObjectData& data, std::string_view name, const std::string& value)
+    {
         // 񑮐
-        data.objectName = elem->Attribute("ObjectName");
-        data.objectType = elem->Attribute("ObjectType");
-        data.objectTag = elem->Attribute("Tag");
-        data.fileName = elem->Attribute("FileName");
-        data.texture = elem->Attribute("Texture");
+        if (name == "ObjectName") { data.objectName = value; return; }
+        if (name == "ObjectType") { data.objectType = value; return; }
+        if (name == "Tag") { data.objectTag = value; return; }
+        if (name == "FileName") { data.fileName = value; return; }
+        if (name == "Texture") { data.texture = value; return; }
+        if (name == "ID") { data.id = ParseNumber(value, 0); return; }
 
-        // float
-        data.pos[0] = GetFloatAttribute(elem, "PosX");
-        data.pos[1] = GetFloatAttribute(elem, "PosY");
-        data.pos[2] = GetFloatAttribute(elem, "PosZ");
+        // float (ϊɎsl̂܂)
+        const std::pair<std::string_view, float*> floats[] = {
+            { "PosX", &data.pos[0] }, { "PosY", &data.pos[1] }, { "PosZ", &data.pos[2] },
+            { "RotX", &data.rot[0] }, { "RotY", &data.rot[1] }, { "RotZ", &data.rot[2] },
+            { "SclX", &data.scl[0] }, { "SclY", &data.scl[1] }, { "SclZ", &data.scl[2] },
+            { "ColR", &data.color[0] }, { "ColG", &data.color[1] }, { "ColB", &data.color[2] }, { "ColA", &data.color[3] },
+        };
+        for (const auto& field : floats)
+        {
+            if (field.first == name) {
+                *field.second = ParseNumber(value, *field.second);
+                return;
+            }
+        }
+    }
 
-        data.rot[0] = GetFloatAttribute(elem, "RotX");
-        data.rot[1] = GetFloatAttribute(elem, "RotY");
-        data.rot[2] = GetFloatAttribute(elem, "RotZ");
+    // ----------------------------------------
+    // Object vf1ǂݐi߂ xml [_[
+    // t@C͈TCYǂݍ݁Aς݂͎̂̕Ă (DOM ͍Ȃ)
+    // ----------------------------------------
+    class XmlObjectStream
+    {
+    private:
+        static constexpr size_t ChunkSize = 64 * 1024;
 
-        data.scl[0] = GetFloatAttribute(elem, "SclX", 1.0f);
-        data.scl[1] = GetFloatAttribute(elem, "SclY", 1.0f);
-        data.scl[2] = GetFloatAttribute(elem, "SclZ", 1.0f);
+        std::ifstream& m_File;
+        std::string m_Buffer;       // ǂݍݍς݂Ŗ̕
+        size_t m_Pos = 0;           // m_Buffer ̏ʒu
+        std::string m_Value;        // l̓WJp (g)
 
-        data.color[0] = GetFloatAttribute(elem, "ColR", 1.0f);
-        data.color[1] = GetFloatAttribute(elem, "ColG", 1.0f);
-        data.color[2] = GetFloatAttribute(elem, "ColB", 1.0f);
-        data.color[3] = GetFloatAttribute(elem, "ColA", 1.0f);
+    public:
+        explicit XmlObjectStream(std::ifstream& file) : m_File(file) {}
 
-        _objectList.push_back(data);
+        int Read(const std::function<void(const ObjectData&)>& onObject)
+        {
+            ObjectData data;
+            int depth = 0;              // vf̐[
+            bool inObjects = false;     // <Objects> ̒
+            bool inObject = false;      // qvf <Object> ̒ (</Object> Œʒm)
+            bool foundObjects = false;
+
+            while (true)
+            {
+                // ̃^O̐擪
+                size_t lt = m_Buffer.find('<', m_Pos);
+                if (lt == std::string::npos) {
+                    m_Pos = m_Buffer.size();
+                    if (!Fill()) break;
+                    continue;
+                }
+                m_Pos = lt;
+
+                // ^OŜobt@ɓ܂œǂݑ
+                size_t end;
+                while ((end = FindMarkupEnd()) == std::string::npos) {
+                    if (!Fill()) {
+                        std::cout << "Unexpected end of XML\n";
+                        return -1;
+                    }
+                }
+                std::string_view tag(m_Buffer.data() + m_Pos, end - m_Pos);
+                m_Pos = end;
+
+                // 錾ERgECDATA Ȃ
+                if (tag[1] == '?' || tag[1] == '!') continue;
+
+                // I^O
+                if (tag[1] == '/') {
+                    depth--;
+                    if (depth == 1 && inObject) {           // </Object> Ŏqvf܂ő
+                        inObject = false;
+                        onObject(data);
+                    }
+                    if (depth == 0 && inObjects) break;     // </Objects> ŏI
+                    continue;
+                }
+
+                // Jn^O
+                bool selfClosing = tag[tag.size() - 2] == '/';
+                std::string_view body = tag.substr(1, tag.size() - (selfClosing ? 3 : 2));
+                size_t nameEnd = body.find_first_of(" \t\r\n");
+                std::string_view name = body.substr(0, nameEnd);
+
+                if (depth == 0 && name == "Objects") {
+                    inObjects = foundObjects = true;
+                    if (selfClosing) break;
+                }
+                else if (depth == 1 && inObjects && name == "Object") {
+                    ResetObjectData(data);
+                    if (nameEnd != std::string_view::npos &&
+                        !ReadAttributes(body.substr(nameEnd), [&data](std::string_view attrName, const std::string& value) {
+                            SetObjectAttribute(data, attrName, value);
+                        })) {
+                        std::cout << "Malformed <Object> element\n";
+                        return -1;
+                    }
+                    if (selfClosing) onObject(data);
+                    else inObject = true;
+                }
+                else if (depth == 2 && inObject && name == "Component") {
+                    ComponentData& component = data.components.emplace_back();
+                    if (nameEnd != std::string_view::npos &&
+                        !ReadAttributes(body.substr(nameEnd), [&component](std::string_view attrName, const std::string& value) {
+                            if (attrName == "Type") component.type = value;
+                            else component.attributes.emplace_back(attrName, value);
+                        })) {
+                        std::cout << "Malformed <Component> element\n";
+                        return -1;
+                    }
+                }
+
+                if (!selfClosing) depth++;
+            }
+
+            if (!foundObjects) {
+                std::cout << "No <Objects> element!\n";
+                return -1;
+            }
+            return 0;
+        }
+
+    private:
+        // ς݂̂̕ĂĎ̉ǂݑ
+        bool Fill()
+        {
+            m_Buffer.erase(0, m_Pos);
+            m_Pos = 0;
+
+            size_t old = m_Buffer.size();
+            m_Buffer.resize(old + ChunkSize);
+            m_File.read(m_Buffer.data() + old, ChunkSize);
+            size_t count = static_cast<size_t>(m_File.gcount());
+            m_Buffer.resize(old + count);
+            return count > 0;
+        }
+
+        // m_Pos  '<' n܂^ȌI[ ('>' ̎) T (obt@Ȃ npos)
+        size_t FindMarkupEnd() const
+        {
+            std::string_view rest(m_Buffer.data() + m_Pos, m_Buffer.size() - m_Pos);
+            if (rest.size() < 4) return std::string::npos;
+
+            if (rest.substr(0, 4) == "<!--") {
+                size_t end = rest.find("-->", 4);
+                return end == std::string_view::npos ? end : m_Pos + end + 3;
+            }
+            if (rest.substr(0, 3) == "<![") {
+                if (rest.size() < 9) return std::string::npos;
+                if (rest.substr(0, 9) == "<![CDATA[") {
+                    size_t end = rest.find("]]>", 9);
+                    return end == std::string_view::npos ? end : m_Pos + end + 3;
+                }
+            }
+
+            // l̒ '>' ͖
+            char quote = 0;
+            for (size_t i = 1; i < rest.size(); i++)
+            {
+                char c = rest[i];
+                if (quote) {
+                    if (c == quote) quote = 0;
+                }
+                else if (c == '"' || c == '\'') {
+                    quote = c;
+                }
+                else if (c == '>') {
+                    return m_Pos + i + 1;
+                }
+            }
+            return std::string::npos;
+        }
+
+        // name="value" ̕тǂ
+        template<typename F>
+        bool ReadAttributes(std::string_view text, F&& onAttribute)
+        {
+            while (true)
+            {
+                size_t start = text.find_first_not_of(" \t\r\n");
+                if (start == std::string_view::npos) return true;
+                text.remove_prefix(start);
+
+                size_t eq = text.find('=');
+                if (eq == std::string_view::npos) return false;
+                std::string_view name = text.substr(0, eq);
+                name = name.substr(0, name.find_first_of(" \t\r\n"));
+                text.remove_prefix(eq + 1);
+
+                size_t open = text.find_first_not_of(" \t\r\n");
+                if (open == std::string_view::npos || (text[open] != '"' && text[open] != '\'')) return false;
+                size_t close = text.find(text[open], open + 1);
+                if (close == std::string_view::npos) return false;
+
+                DecodeEntities(text.substr(open + 1, close - open - 1), m_Value);
+                onAttribute(name, m_Value);
+                text.remove_prefix(close + 1);
+            }
+        }
+    };
+}
+
+int XmlRW::ReadObjects(const char* _stage, const std::function<void(const ObjectData&)>& _onObject)
+{
+    std::ifstream file(compose_file_name(_stage), std::ios::binary);
+    if (!file) {
+        std::cout << "Failed to load XML\n";
+        return -1;
     }
 
-    return 0;
+    XmlObjectStream stream(file);
+    return stream.Read(_onObject);
 }
 
-void XmlRW::UpdateObjectsInXML(const std::vector<ObjectData>& objects, const char* _stage)
+int XmlRW::GetObjectData(const char* _stage, std::vector<ObjectData>& _objectList)
 {
-    XMLDocument doc;
+    return ReadObjects(_stage, [&_objectList](const ObjectData& data)
+    {
+        _objectList.push_back(data);
+    });
+}
 
-    std::string fileName = compose_file_name(_stage);
-    // XML ̓ǂݍ݁it@CDj
-    if (doc.LoadFile(fileName.c_str()) != XML_SUCCESS) {
-        // t@Cꍇ͐VK쐬
-        doc.InsertFirstChild(doc.NewElement("Objects"));
-    }
+namespace
+{
+    // ----------------------------------------
+    // ۑ (Xe[WƂ DOM Ɗe Object ̓ẽnbVێ)
+    // O̕ۑςĂȂ Object ͑At@CǂݒȂ
+    // ----------------------------------------
+    struct SavedObject
+    {
+        XMLElement* element;    // DOM ̗vf
+        size_t hash;            // ŌɏẽnbV
+    };
 
-    XMLElement* root = doc.FirstChildElement("Objects");
-    if (!root) {
-        root = doc.NewElement("Objects");
-        doc.InsertFirstChild(root);
-    }
+    struct SaveJournal
+    {
+        XMLDocument doc;
+        std::unordered_map<std::string, SavedObject> objects;  // ObjectName ň
+        std::filesystem::file_time_type writeTime;              // Ōɏt@C̍XV
+    };
 
-    // ObjectName L[ƂĈ߁A Object }bvɂ
-    std::unordered_map<std::string, XMLElement*> existingMap;
+    std::mutex s_SaveMutex;
+    std::unordered_map<std::string, std::unique_ptr<SaveJournal>> s_SaveJournals;  // t@Cň
 
-    for (XMLElement* elem = root->FirstChildElement("Object"); elem; elem = elem->NextSiblingElement("Object"))
+    void HashCombine(size_t& seed, size_t value)
     {
-        const char* name = elem->Attribute("ObjectName");
-        if (name) {
-            existingMap[name] = elem;
-        }
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
     }
 
-    // ----------------------------------------
-    // 1. newObjects ƍčXV or ǉ
-    // ----------------------------------------
-    for (const auto& obj : objects)
+    // ۑ鑮̃nbV (ID ͕ۑȂ̂Ŋ܂߂Ȃ)
+    size_t HashObjectData(const ObjectData& data)
     {
-        XMLElement* element = nullptr;
+        std::hash<std::string> hashString;
+        size_t seed = 0;
+        HashCombine(seed, hashString(data.objectName));
+        HashCombine(seed, hashString(data.objectType));
+        HashCombine(seed, hashString(data.objectTag));
+        HashCombine(seed, hashString(data.fileName));
+        HashCombine(seed, hashString(data.texture));
 
-        auto it = existingMap.find(obj.objectName);
-        if (it != existingMap.end()) {
-            // IuWFNg  XV
-            element = it->second;
+        std::hash<std::string_view> hashBytes;
+        auto hashFloats = [&](const float* values, size_t count)
+        {
+            HashCombine(seed, hashBytes(std::string_view(reinterpret_cast<const char*>(values), count * sizeof(float))));
+        };
+        hashFloats(data.pos, 3);
+        hashFloats(data.rot, 3);
+        hashFloats(data.scl, 3);
+        hashFloats(data.color, 4);
+
+        for (const ComponentData& component : data.components)
+        {
+            HashCombine(seed, hashString(component.type));
+            for (const auto& [name, value] : component.attributes)
+            {
+                HashCombine(seed, hashString(name));
+                HashCombine(seed, hashString(value));
+            }
         }
-        else {
-            // VKIuWFNg  ǉ
-            element = doc.NewElement("Object");
-            root->InsertEndChild(element);
+        return seed;
+    }
+
+    // ̗vf ObjectData 𕜌 (ۑ̏p)
+    ObjectData ReadObjectElement(const XMLElement* elem)
+    {
+        ObjectData data;
+        ResetObjectData(data);
+        for (const XMLAttribute* attr = elem->FirstAttribute(); attr; attr = attr->Next())
+        {
+            // tinyxml2 ͕QƂWJς
+            SetObjectAttribute(data, attr->Name(), attr->Value());
+        }
+        for (const XMLElement* child = elem->FirstChildElement("Component"); child; child = child->NextSiblingElement("Component"))
+        {
+            ComponentData& component = data.components.emplace_back();
+            for (const XMLAttribute* attr = child->FirstAttribute(); attr; attr = attr->Next())
+            {
+                if (std::string_view(attr->Name()) == "Type") component.type = attr->Value();
+                else component.attributes.emplace_back(attr->Name(), attr->Value());
+            }
         }
+        return data;
+    }
 
+    void WriteObjectElement(XMLElement* element, const ObjectData& obj)
+    {
         // ݒi㏑j
         // 񑮐
         element->SetAttribute("ObjectName", obj.objectName.c_str());
@@ -142,36 +468,141 @@ void XmlRW::UpdateObjectsInXML(const std::vector<ObjectData>& objects, const cha
         element->SetAttribute("ColG", obj.color[1]);
         element->SetAttribute("ColB", obj.color[2]);
         element->SetAttribute("ColA", obj.color[3]);
+
+        // R|[lg (qvf͂܂Ƃ߂č蒼)
+        while (XMLElement* child = element->FirstChildElement("Component")) {
+            element->DeleteChild(child);
+        }
+        for (const ComponentData& component : obj.components)
+        {
+            XMLElement* child = element->GetDocument()->NewElement("Component");
+            child->SetAttribute("Type", component.type.c_str());
+            for (const auto& [name, value] : component.attributes) {
+                child->SetAttribute(name.c_str(), value.c_str());
+            }
+            element->InsertEndChild(child);
+        }
+    }
+
+    // t@Cۑ蒼
+    std::unique_ptr<SaveJournal> LoadSaveJournal(const std::string& fileName)
+    {
+        auto journal = std::make_unique<SaveJournal>();
+        XMLDocument& doc = journal->doc;
+
+        // XML ̓ǂݍ݁it@CDj
+        if (doc.LoadFile(fileName.c_str()) != XML_SUCCESS) {
+            // t@Cꍇ͐VK쐬
+            doc.Clear();
+            doc.InsertFirstChild(doc.NewElement("Objects"));
+        }
+
+        XMLElement* root = doc.FirstChildElement("Objects");
+        if (!root) {
+            root = doc.NewElement("Objects");
+            doc.InsertFirstChild(root);
+        }
+
+        // ObjectName L[ƂĈ߁A Object }bvɂ
+        for (XMLElement* elem = root->FirstChildElement("Object"); elem; elem = elem->NextSiblingElement("Object"))
+        {
+            const char* name = elem->Attribute("ObjectName");
+            if (name) {
+                journal->objects[name] = { elem, HashObjectData(ReadObjectElement(elem)) };
+            }
+        }
+        return journal;
+    }
+}
+
+int XmlRW::UpdateObjectsInXML(const std::vector<ObjectData>& objects, const char* _stage)
+{
+    std::lock_guard<std::mutex> lock(s_SaveMutex);
+
+    std::string fileName = compose_file_name(_stage);
+
+    // O̕ۑȍ~Ƀt@COŏĂȂ DOM g
+    std::error_code ec;
+    auto writeTime = std::filesystem::last_write_time(fileName, ec);
+    auto& journal = s_SaveJournals[fileName];
+    if (!journal || ec || journal->writeTime != writeTime) {
+        journal = LoadSaveJournal(fileName);
+    }
+
+    XMLDocument& doc = journal->doc;
+    XMLElement* root = doc.FirstChildElement("Objects");
+
+    // ----------------------------------------
+    // 1. newObjects ƍčXV or ǉ (eς̂)
+    // ----------------------------------------
+    std::unordered_set<std::string_view> names;
+    names.reserve(objects.size());
+    size_t changed = 0;
+
+    for (const auto& obj : objects)
+    {
+        names.insert(obj.objectName);
+        size_t hash = HashObjectData(obj);
+
+        auto it = journal->objects.find(obj.objectName);
+        if (it != journal->objects.end()) {
+            // IuWFNg  ύX΍XV
+            if (it->second.hash == hash) continue;
+            it->second.hash = hash;
+            WriteObjectElement(it->second.element, obj);
+        }
+        else {
+            // VKIuWFNg  ǉ
+            XMLElement* element = doc.NewElement("Object");
+            root->InsertEndChild(element);
+            WriteObjectElement(element, obj);
+            journal->objects[obj.objectName] = { element, hash };
+        }
+        changed++;
     }
 
     // ----------------------------------------
     // 2. 폜IvViVf[^ɖ Object 폜j
     // ----------------------------------------
     bool enableDelete = true;
+    size_t removed = 0;
 
     if (enableDelete)
     {
-        for (auto& it : existingMap)
+        for (auto it = journal->objects.begin(); it != journal->objects.end();)
         {
-            bool existsInNew = false;
-            for (auto& obj : objects)
-            {
-                if (obj.objectName == it.first) {
-                    existsInNew = true;
-                    break;
-                }
-            }
-
-            if (!existsInNew) {
+            if (!names.contains(it->first)) {
                 // 폜
-                root->DeleteChild(it.second);
+                root->DeleteChild(it->second.element);
+                it = journal->objects.erase(it);
+                removed++;
+            }
+            else {
+                ++it;
             }
         }
     }
 
-    // ۑ
-    XMLError err = doc.SaveFile(fileName.c_str());
-    if (err != XML_SUCCESS) {
-        printf("Failed to save XML: %s\n", fileName);
+    // ύXΏ܂Ȃ
+    if (changed == 0 && removed == 0 && !ec) {
+        std::cout << "No changes to save: " << fileName << "\n";
+        return 0;
     }
+
+    // ۑ (̃t@Cǂ܂Ȃ悤ꎞt@CɏĂu)
+    std::string tempName = fileName + ".tmp";
+    XMLError err = doc.SaveFile(tempName.c_str());
+    if (err == XML_SUCCESS) {
+        std::filesystem::rename(tempName, fileName, ec);
+    }
+    if (err != XML_SUCCESS || ec) {
+        printf("Failed to save XML: %s\n", fileName.c_str());
+        // ̓t@Cǂݒ
+        s_SaveJournals.erase(fileName);
+        return -1;
+    }
+
+    journal->writeTime = std::filesystem::last_write_time(fileName, ec);
+    std::cout << "Saved " << changed << " changed, " << removed << " removed: " << fileName << "\n";
+    return 0;
 }
@@ -1,6 +1,17 @@
 #pragma once
+#include <functional>
 #include <vector>
 #include <string>
+#include <utility>
+
+// <Object> ̎qvf <Component Type="..." .../> (l xml ̂̕܂܎)
+struct ComponentData
+{
+    std::string type;
+    std::vector<std::pair<std::string, std::string>> attributes;
+
+    bool operator==(const ComponentData&) const = default;
+};
 
 struct ObjectData
 {
@@ -14,6 +25,7 @@ struct ObjectData
     float rot[3];
     float scl[3];
     float color[4];
+    std::vector<ComponentData> components;  // `ȊÕR|[lg
 };
 
 class XmlRW
@@ -21,7 +33,13 @@ class XmlRW
 private:
 
 public:
+    // Object vf1ǂނƂ _onObject Ă (t@CŜ DOM ɓWJȂ)
+    // n ObjectData ͎g񂳂̂ŁAĂяôݗL
+    int ReadObjects(const char* _stage, const std::function<void(const ObjectData&)>& _onObject);
+    // S Object zŎ擾
     int GetObjectData(const char* _stage, std::vector<ObjectData>& _objectList);
-    void UpdateObjectsInXML(const std::vector<ObjectData>& objects, const char* _stage);
+    // S Object ۑ (O̕ۑς Object A Object ͍폜)
+    // [J[XbhĂł悢 (ɌĂ΂ꂽꍇ͏ɏ)
+    int UpdateObjectsInXML(const std::vector<ObjectData>& objects, const char* _stage);
 };
 
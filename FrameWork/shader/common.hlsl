@@ -19,6 +19,15 @@ struct VS_IN
     float2 tex : TEXCOORD0;
 };
 
+// k_ (VERTEX_PACKED)B̓CAEg UNORM / SNORM / x float ɕϊς
+struct VS_IN_PACKED
+{
+    float4 pos : POSITION0; // E{bNX̊ (0~1)
+    float2 nrm : NORMAL0;   // ʑ̂ɓWJ@ (-1~1)
+    float4 col : COLOR0;
+    float2 tex : TEXCOORD0;
+};
+
 struct PS_IN
 {
 	float4 pos : SV_POSITION;
@@ -60,4 +69,28 @@ cbuffer MaterialBuffer : register(b4)
 cbuffer TextureBuffer : register(b5)
 {
     matrix matrixTex;
+}
+
+// k_̈ʒu̕ (ʒu = l * Scale + Offset)
+cbuffer QuantizationBuffer : register(b6)
+{
+    float4 PositionOffset;
+    float4 PositionScale;
+}
+
+// k_ VS_IN ɖ߂
+VS_IN DecodePackedVertex(VS_IN_PACKED input)
+{
+    VS_IN output;
+    output.pos = float4(input.pos.xyz * PositionScale.xyz + PositionOffset.xyz, 1.0);
+
+    // ʑ̂̉ (z < 0) ͐܂ԂĂ̂Ŗ߂
+    float3 n = float3(input.nrm.xy, 1.0 - abs(input.nrm.x) - abs(input.nrm.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0) ? -t : t;
+    output.nrm = float4(normalize(n), 0.0);
+
+    output.col = input.col;
+    output.tex = input.tex;
+    return output;
 }
\ No newline at end of file
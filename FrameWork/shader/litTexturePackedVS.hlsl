@@ -0,0 +1,39 @@
+#include "common.hlsl"
+
+// k_ (VERTEX_PACKED) p litTextureVS
+PS_IN main(in VS_IN_PACKED packed)
+{
+    PS_IN output;
+
+	// k_𕜌 (ȍ~ litTextureVS Ɠ)
+    VS_IN input = DecodePackedVertex(packed);
+
+	//positoin=============================
+	// [hAr[AvWFNVs|킹čWϊs
+    matrix wvp;
+    wvp = mul(World, View);
+    wvp = mul(wvp, Projection);
+    output.pos = mul(input.pos, wvp);
+	
+	//color=============================
+	// @xNg̕ϊƐKs
+	// ͂ꂽ@[hԂɕϊAK
+    float4 normal = float4(input.nrm.xyz, 0.0); // ͖@float4ɕϊ
+    float4 worldNormal = mul(normal, World); // @[hԂɕϊ
+    worldNormal = normalize(worldNormal); // @xNg𐳋K
+	
+	// Ɩ@xNg̓ςvZĊgU߂
+    float d = -dot(Light.Direction.xyz, worldNormal.xyz); // ̕Ɩ@̓ςvZ
+    d = saturate(d); // d̒l0~1ɃNv
+	
+    output.col.xyz = input.col.xyz * d * Light.Diffuse.xyz; // gỦeZ
+    output.col.xyz += input.col.xyz * Light.Ambient.xyz; // ArGgZ
+    output.col.xyz += Material.Emission.xyz; // EmissionZ
+    output.col.a = input.col.a * Material.Diffuse.a; // At@l
+	
+	//texture=============================
+	// eNX`W͂̂܂܎gp
+    output.tex = input.tex;
+	
+    return output;
+}